@@ -1,15 +1,32 @@
 #ifndef BARRIER_CLOSURE_H_
 #define BARRIER_CLOSURE_H_
 
+#include <atomic>
 #include "callback.h"
-#include "thirdparty/perftools/atomicops.h"
+#include "thirdparty/glog/logging.h"
 
 // 继承Closure回调类，支持不带参数的成员函数Run()
 // 用途：调用left_次BarrierClosure::Run后调用done_Run
+//
+// quorum模式：BarrierClosure(n, k, done)在第k次Run时调用done的Run，
+// 之后剩下的n-k次Run只减计数，第n次Run时delete自己。用于多副本/对冲
+// 请求，先回来的k个就可以往下走；晚到的调用方自己用到的东西要保持有效
+//
+// 内存序：每次到达只用release减计数，把自己之前的写发布出去；调用done
+// 的那次到达再acquire读一次计数，和之前所有到达方的release同步，看到它们
+// 的写。不用acquire fence，ThreadSanitizer认不出fence。下面几个barrier
+// 都是这样。quorum模式下done跑的时候晚到的可能已经delete了barrier，
+// 不能再读，所以每次到达直接用acq_rel
 class BarrierClosure : public Closure {
  public:
   BarrierClosure(int n, Closure* done)
-    : left_(n), done_(done) { }
+    : left_(n), done_left_(0), done_(done) { }
+
+  BarrierClosure(int n, int quorum, Closure* done)
+    : left_(n), done_left_(n - quorum), done_(done) {
+    CHECK(quorum > 0 && quorum <= n)
+        << "quorum " << quorum << " out of [1, " << n << "]";
+  }
 
   ~BarrierClosure() { }
 
@@ -18,17 +35,123 @@ class BarrierClosure : public Closure {
   }
 
   void Run() {
-    // 调用left_次BarrierClosure::Run()后调用done_的Run()
-    if (0 == base::subtle::Barrier_AtomicIncrement(&left_, -1)) {
-      done_->Run();
+    // 先把成员取出来：减计数以后，最后到达的线程随时可能delete this
+    Closure* done = done_;
+    int done_left = done_left_;
+    int left;
+    if (done_left == 0) {
+      left = left_.fetch_sub(1, std::memory_order_release) - 1;
+      if (left == 0) {
+        left_.load(std::memory_order_acquire);
+      }
+    } else {
+      left = left_.fetch_sub(1, std::memory_order_acq_rel) - 1;
+    }
+    if (left == done_left) {
+      done->Run();
+    }
+    if (left == 0) {
       delete this;
     }
   }
 
  private:
-  int left_;
+  std::atomic<int> left_;
+  // left_减到这个值时调用done_，普通模式下是0
+  const int done_left_;
   Closure* done_;
   DISALLOW_COPY_AND_ASSIGN(BarrierClosure);
 };
 
+// 可重复使用的BarrierClosure：嵌在别的对象里，每一轮用Reset(n, done)
+// 重新设定计数和回调，调用n次Run后调用done的Run；自己不会delete
+class ResettableBarrierClosure : public Closure {
+ public:
+  ResettableBarrierClosure() : left_(0), done_(NULL) { }
+
+  ~ResettableBarrierClosure() { }
+
+  virtual bool IsRepeatable() const {
+    return true;
+  }
+
+  // 开始新的一轮；上一轮的done开始跑之后才能调用，包括在done里调用
+  void Reset(int n, Closure* done) {
+    left_.store(n, std::memory_order_relaxed);
+    done_ = done;
+  }
+
+  void Run() {
+    if (left_.fetch_sub(1, std::memory_order_release) == 1) {
+      left_.load(std::memory_order_acquire);
+      // done可能直接Reset开始下一轮，之后不能再碰成员
+      Closure* done = done_;
+      done_ = NULL;
+      done->Run();
+    }
+  }
+
+ private:
+  std::atomic<int> left_;
+  Closure* done_;
+  DISALLOW_COPY_AND_ASSIGN(ResettableBarrierClosure);
+};
+
+// 参与方个数事先不确定的barrier：嵌在别的对象里，每一轮Reset(done)后
+// 用Add(k)登记参与方，可以和已登记参与方的Run同时进行；全部登记完后调用
+// Seal()，之后已登记的Run都到达时调用done的Run(可能就在Seal里)。
+// 这样不用先把参与方都构造好，构造好一个就可以先放出去一个。自己不会delete
+class PhaserClosure : public Closure {
+ public:
+  PhaserClosure() : state_(0), done_(NULL) { }
+
+  ~PhaserClosure() { }
+
+  virtual bool IsRepeatable() const {
+    return true;
+  }
+
+  // 开始新的一轮；同ResettableBarrierClosure::Reset
+  void Reset(Closure* done) {
+    state_.store(0, std::memory_order_relaxed);
+    done_ = done;
+  }
+
+  // Seal之前，在把这k个参与方放出去之前调用
+  void Add(int k) {
+    int state = state_.fetch_add(k * kOne, std::memory_order_relaxed);
+    DCHECK(!(state & kSealed)) << "Add after Seal";
+  }
+
+  void Seal() {
+    if (state_.fetch_or(kSealed, std::memory_order_release) == 0) {
+      RunDone();
+    }
+  }
+
+  void Run() {
+    if (state_.fetch_sub(kOne, std::memory_order_release) ==
+        (kOne | kSealed)) {
+      RunDone();
+    }
+  }
+
+ private:
+  // 最低位是sealed，其余是还没到达的参与方个数
+  static const int kSealed = 1;
+  static const int kOne = 2;
+
+  void RunDone() {
+    state_.load(std::memory_order_acquire);
+    // done可能直接Reset开始下一轮，之后不能再碰成员
+    Closure* done = done_;
+    done_ = NULL;
+    done->Run();
+  }
+
+  std::atomic<int> state_;
+  Closure* done_;
+  DISALLOW_COPY_AND_ASSIGN(PhaserClosure);
+};
+
 #endif  // BARRIER_CLOSURE_H_
@@ -0,0 +1,119 @@
+#include "common/base/barrier_closure.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "common/base/sharded_barrier_closure.h"
+#include "thirdparty/benchmark/benchmark.h"
+
+// BM_Arrive is the cost of one uncontended arrival.  BM_FanIn is N threads
+// arriving at one barrier: each iteration is one round, a new barrier for
+// N * kArrivalsPerThread arrivals which every thread runs
+// kArrivalsPerThread times; the round ends when done runs.
+//
+// SeqCstBarrierClosure is BarrierClosure as it was with perftools'
+// Barrier_AtomicIncrement: a full fence on every arrival.  On x86 both are
+// one locked instruction, so they should be level there; the fences only
+// differ on weaker memory models.
+//
+//   barrier_closure_benchmark --benchmark_format=json
+
+static const int kArrivalsPerThread = 4096;
+
+class SeqCstBarrierClosure : public Closure {
+ public:
+  SeqCstBarrierClosure(int n, Closure* done) : left_(n), done_(done) {}
+  virtual bool IsRepeatable() const { return false; }
+  virtual void Run() {
+    Closure* done = done_;
+    if (left_.fetch_sub(1, std::memory_order_seq_cst) == 1) {
+      done->Run();
+      delete this;
+    }
+  }
+
+ private:
+  std::atomic<int> left_;
+  Closure* done_;
+};
+
+static void Nop() {}
+
+template <typename Barrier>
+static void BM_Arrive(benchmark::State& state) {
+  Closure* done = NewPermanentCallback(&Nop);
+  for (auto _ : state) {
+    Closure* barrier = new Barrier(kArrivalsPerThread, done);
+    for (int i = 0; i < kArrivalsPerThread; ++i) {
+      barrier->Run();
+    }
+  }
+  delete done;
+  state.SetItemsProcessed(state.iterations() * kArrivalsPerThread);
+}
+
+BENCHMARK_TEMPLATE(BM_Arrive, SeqCstBarrierClosure);
+BENCHMARK_TEMPLATE(BM_Arrive, BarrierClosure);
+BENCHMARK_TEMPLATE(BM_Arrive, ShardedBarrierClosure);
+
+static void SetFinished(std::atomic<bool>* finished) {
+  finished->store(true, std::memory_order_release);
+}
+
+static void Arrive(std::atomic<Closure*>* barrier,
+                   const std::atomic<int>* round) {
+  int last = 0;
+  for (;;) {
+    int current;
+    while ((current = round->load(std::memory_order_acquire)) == last) {
+      std::this_thread::yield();
+    }
+    if (current < 0) {
+      return;
+    }
+    Closure* closure = barrier->load(std::memory_order_acquire);
+    for (int i = 0; i < kArrivalsPerThread; ++i) {
+      closure->Run();
+    }
+    last = current;
+  }
+}
+
+template <typename Barrier>
+static void BM_FanIn(benchmark::State& state) {
+  const int thread_num = static_cast<int>(state.range(0));
+  std::atomic<Closure*> barrier(NULL);
+  std::atomic<int> round(0);
+  std::atomic<bool> finished(false);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < thread_num; ++i) {
+    threads.push_back(std::thread(&Arrive, &barrier, &round));
+  }
+
+  for (auto _ : state) {
+    finished.store(false, std::memory_order_relaxed);
+    barrier.store(new Barrier(thread_num * kArrivalsPerThread,
+                              NewCallback(&SetFinished, &finished)),
+                  std::memory_order_release);
+    round.fetch_add(1, std::memory_order_release);
+    while (!finished.load(std::memory_order_acquire)) {
+      std::this_thread::yield();
+    }
+  }
+
+  round.store(-1, std::memory_order_release);
+  for (size_t i = 0; i < threads.size(); ++i) {
+    threads[i].join();
+  }
+  state.SetItemsProcessed(state.iterations() * thread_num *
+                          kArrivalsPerThread);
+}
+
+BENCHMARK_TEMPLATE(BM_FanIn, SeqCstBarrierClosure)
+    ->RangeMultiplier(2)->Range(8, 256)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_FanIn, BarrierClosure)
+    ->RangeMultiplier(2)->Range(8, 256)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_FanIn, ShardedBarrierClosure)
+    ->RangeMultiplier(2)->Range(8, 256)->UseRealTime();
+
+BENCHMARK_MAIN();
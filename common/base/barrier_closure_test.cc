@@ -1,4 +1,5 @@
 #include "barrier_closure.h"
+#include <atomic>
 #include <vector>
 #include "callback.h"
 #include "thirdparty/gtest/gtest.h"
@@ -35,3 +36,172 @@ TEST(BarrierClosureTest, MultipleThreadTest) {
   barrier_done->Run();
   EXPECT_EQ(1, i);
 }
+
+TEST(BarrierClosureTest, ResettableTest) {
+  int i = 0;
+  Closure* done = NewPermanentCallback(&DoInc, &i);
+  ResettableBarrierClosure barrier;
+  for (int round = 1; round <= 3; ++round) {
+    barrier.Reset(round, done);
+    for (int k = 0; k < round; ++k) {
+      EXPECT_EQ(round - 1, i);
+      barrier.Run();
+    }
+    EXPECT_EQ(round, i);
+  }
+  delete done;
+}
+
+class ChainedRounds {
+ public:
+  explicit ChainedRounds(int rounds) : rounds_(rounds), finished_(0) {}
+  void Start() {
+    barrier_.Reset(2, NewCallback(this, &ChainedRounds::RoundDone));
+    barrier_.Run();
+    barrier_.Run();
+  }
+  int finished() const { return finished_; }
+
+ private:
+  // 在done里直接Reset开始下一轮
+  void RoundDone() {
+    if (++finished_ < rounds_) {
+      Start();
+    }
+  }
+
+  int rounds_;
+  int finished_;
+  ResettableBarrierClosure barrier_;
+};
+
+TEST(BarrierClosureTest, ResetFromDone) {
+  ChainedRounds rounds(10);
+  rounds.Start();
+  EXPECT_EQ(10, rounds.finished());
+}
+
+TEST(BarrierClosureTest, ResettableMultipleThreadTest) {
+  int i = 0;
+  const int kThreadNum = 100;
+  Closure* done = NewPermanentCallback(&DoInc, &i);
+  ResettableBarrierClosure barrier;
+  for (int round = 1; round <= 3; ++round) {
+    barrier.Reset(kThreadNum + 1, done);
+    std::vector<shared_ptr<Thread> > threads(kThreadNum);
+    for (int k = 0; k < kThreadNum; ++k) {
+      threads[k].reset(new Thread(&barrier));
+      threads[k]->Start();
+    }
+    for (int k = 0; k < kThreadNum; ++k) {
+      threads[k]->Join();
+    }
+    EXPECT_EQ(round - 1, i);
+    barrier.Run();
+    EXPECT_EQ(round, i);
+  }
+  delete done;
+}
+
+TEST(BarrierClosureTest, QuorumTest) {
+  int i = 0;
+  Closure* barrier_done = new BarrierClosure(3, 2, NewCallback(&DoInc, &i));
+  barrier_done->Run();
+  EXPECT_EQ(0, i);
+  barrier_done->Run();
+  EXPECT_EQ(1, i);
+  // 晚到的只减计数，最后一个delete barrier
+  barrier_done->Run();
+  EXPECT_EQ(1, i);
+}
+
+TEST(BarrierClosureTest, QuorumOfAllTest) {
+  int i = 0;
+  Closure* barrier_done = new BarrierClosure(2, 2, NewCallback(&DoInc, &i));
+  barrier_done->Run();
+  EXPECT_EQ(0, i);
+  barrier_done->Run();
+  EXPECT_EQ(1, i);
+}
+
+static void CountQuorum(std::atomic<int>* done_count,
+                        std::atomic<int>* arrived, int quorum) {
+  // done跑的时候至少已经有quorum个到达
+  EXPECT_GE(arrived->load(), quorum);
+  done_count->fetch_add(1);
+}
+
+static void Arrive(std::atomic<int>* arrived, Closure* barrier_done) {
+  arrived->fetch_add(1);
+  barrier_done->Run();
+}
+
+// 和最后到达的线程并发跑的done不能碰到已经释放的barrier，用ASan检查
+TEST(BarrierClosureTest, QuorumMultipleThreadTest) {
+  const int kThreadNum = 8;
+  const int kRoundNum = 200;
+  std::atomic<int> done_count(0);
+  for (int round = 0; round < kRoundNum; ++round) {
+    int quorum = round % kThreadNum + 1;
+    std::atomic<int> arrived(0);
+    Closure* barrier_done = new BarrierClosure(
+        kThreadNum, quorum,
+        NewCallback(&CountQuorum, &done_count, &arrived, quorum));
+    std::vector<shared_ptr<Thread> > threads(kThreadNum);
+    for (int k = 0; k < kThreadNum; ++k) {
+      threads[k].reset(new Thread(NewCallback(&Arrive, &arrived,
+                                              barrier_done)));
+      threads[k]->Start();
+    }
+    for (int k = 0; k < kThreadNum; ++k) {
+      threads[k]->Join();
+    }
+    EXPECT_EQ(round + 1, done_count.load());
+  }
+}
+
+TEST(BarrierClosureTest, PhaserTest) {
+  int i = 0;
+  Closure* done = NewPermanentCallback(&DoInc, &i);
+  PhaserClosure phaser;
+  phaser.Reset(done);
+  phaser.Add(1);
+  phaser.Run();
+  // 还没Seal，计数到0也不调用done
+  EXPECT_EQ(0, i);
+  phaser.Add(2);
+  phaser.Run();
+  phaser.Seal();
+  EXPECT_EQ(0, i);
+  phaser.Run();
+  EXPECT_EQ(1, i);
+
+  // 没有参与方时在Seal里调用done
+  phaser.Reset(done);
+  phaser.Seal();
+  EXPECT_EQ(2, i);
+  delete done;
+}
+
+// 参与方边登记边在别的线程上到达
+TEST(BarrierClosureTest, PhaserMultipleThreadTest) {
+  int i = 0;
+  const int kThreadNum = 100;
+  Closure* done = NewPermanentCallback(&DoInc, &i);
+  PhaserClosure phaser;
+  for (int round = 1; round <= 3; ++round) {
+    phaser.Reset(done);
+    std::vector<shared_ptr<Thread> > threads(kThreadNum);
+    for (int k = 0; k < kThreadNum; ++k) {
+      phaser.Add(1);
+      threads[k].reset(new Thread(&phaser));
+      threads[k]->Start();
+    }
+    phaser.Seal();
+    for (int k = 0; k < kThreadNum; ++k) {
+      threads[k]->Join();
+    }
+    EXPECT_EQ(round, i);
+  }
+  delete done;
+}
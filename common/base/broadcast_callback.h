@@ -0,0 +1,155 @@
+#ifndef COMMON_BASE_BROADCAST_CALLBACK_H_
+#define COMMON_BASE_BROADCAST_CALLBACK_H_
+
+#include <stddef.h>
+#include <atomic>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "common/base/callback.h"
+#include "common/base/callback_pool.h"
+#include "common/base/thread_pool.h"
+#include "thirdparty/glog/logging.h"
+
+// A BroadcastCallback<void(Args...)> is a self-deleting Callback which, when
+// run, runs each of its subscribers (also Callback<void(Args...)>s) with the
+// same arguments:
+//
+//   Callback<void(const Response&)>* done =
+//       NewBroadcastCallback<void(const Response&)>(3);
+//   done->Add(NewCallback(&cache_, &Cache::Store));
+//   done->Add(NewCallback(this, &Handler::Reply, controller));
+//   done->Add(NewPermanentCallback(&stats_, &Stats::Count));
+//   service->Search(..., done);
+//
+// The broadcast and its subscriber array are one allocation, from
+// CallbackPool while they fit.  Subscribers are run in the order they were
+// added; with a const reference signature the argument is shared by all of
+// them rather than copied for each.  Self-deleting subscribers delete
+// themselves as usual, permanent ones stay with their owner.
+//
+// Given a ThreadPool, Run() instead copies the arguments once into the
+// broadcast, hands one task per subscriber to the pool, and returns; the
+// broadcast deletes itself when the last subscriber has run.
+template <typename Signature>
+class BroadcastCallback;
+
+template <typename... Args>
+class BroadcastCallback<void(Args...)> : public Callback<void(Args...)> {
+ public:
+  typedef Callback<void(Args...)> Subscriber;
+
+  // Room for capacity subscribers.  With a thread_pool, subscribers run on
+  // it in parallel.
+  static BroadcastCallback* Create(size_t capacity,
+                                   ThreadPool* thread_pool = NULL) {
+    size_t size = kHeaderSize + sizeof(BroadcastCallback) +
+        capacity * sizeof(Task);
+    char* block = static_cast<char*>(CallbackPool::Allocate(size));
+    *reinterpret_cast<size_t*>(block) = size;
+    return new (block + kHeaderSize) BroadcastCallback(capacity, thread_pool);
+  }
+
+  static void operator delete(void* object) {
+    char* block = static_cast<char*>(object) - kHeaderSize;
+    CallbackPool::Deallocate(block, *reinterpret_cast<size_t*>(block));
+  }
+
+  virtual ~BroadcastCallback() {
+    for (size_t i = 0; i < capacity_; ++i) {
+      tasks()[i].~Task();
+    }
+  }
+
+  // Before Run() only.
+  void Add(Subscriber* subscriber) {
+    CHECK_LT(size_, capacity_) << "BroadcastCallback is full";
+    tasks()[size_++].subscriber = subscriber;
+  }
+
+  size_t size() const {
+    return size_;
+  }
+
+  virtual bool IsRepeatable() const { return false; }
+
+  virtual void Run(Args... args) {
+    if (thread_pool_ == NULL || size_ == 0) {
+      CallbackAutoDeleter<BroadcastCallback, true> self_deleter(this);
+      for (size_t i = 0; i < size_; ++i) {
+        tasks()[i].subscriber->Run(args...);
+      }
+      return;
+    }
+    new (&arguments_) Arguments(args...);
+    pending_.store(size_, std::memory_order_relaxed);
+    // Reads size_ before the last task can delete this.
+    size_t size = size_;
+    for (size_t i = 0; i < size; ++i) {
+      thread_pool_->AddTask(&tasks()[i]);
+    }
+  }
+
+ private:
+  typedef std::tuple<typename std::decay<Args>::type...> Arguments;
+
+  // Keeps the object behind the size word 16-byte aligned.
+  static const size_t kHeaderSize = 16;
+
+  // Runs one subscriber on the thread pool.
+  class Task : public Closure {
+   public:
+    Task() : owner(NULL), subscriber(NULL) {}
+    virtual bool IsRepeatable() const { return true; }
+    virtual void Run() {
+      owner->RunSubscriber(
+          subscriber,
+          typename MakeCallbackIndexes<sizeof...(Args)>::type());
+    }
+
+    BroadcastCallback* owner;
+    Subscriber* subscriber;
+  };
+
+  BroadcastCallback(size_t capacity, ThreadPool* thread_pool)
+      : capacity_(capacity), size_(0), thread_pool_(thread_pool),
+        pending_(0) {
+    for (size_t i = 0; i < capacity_; ++i) {
+      new (&tasks()[i]) Task;
+      tasks()[i].owner = this;
+    }
+  }
+
+  Task* tasks() {
+    return reinterpret_cast<Task*>(this + 1);
+  }
+
+  template <size_t... Indexes>
+  void RunSubscriber(Subscriber* subscriber, CallbackIndexes<Indexes...>) {
+    Arguments& arguments = *reinterpret_cast<Arguments*>(&arguments_);
+    subscriber->Run(std::get<Indexes>(arguments)...);
+    if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      arguments.~Arguments();
+      delete this;
+    }
+  }
+
+  size_t capacity_;
+  size_t size_;
+  ThreadPool* thread_pool_;
+  std::atomic<size_t> pending_;
+  // The arguments of Run(), when subscribers run on thread_pool_.
+  typename std::aligned_storage<sizeof(Arguments),
+                                alignof(Arguments)>::type arguments_;
+
+  DISALLOW_COPY_AND_ASSIGN(BroadcastCallback);
+};
+
+template <typename Signature>
+BroadcastCallback<Signature>* NewBroadcastCallback(
+    size_t capacity, ThreadPool* thread_pool = NULL) {
+  return BroadcastCallback<Signature>::Create(capacity, thread_pool);
+}
+
+#endif  // COMMON_BASE_BROADCAST_CALLBACK_H_
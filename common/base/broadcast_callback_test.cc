@@ -0,0 +1,112 @@
+#include "common/base/broadcast_callback.h"
+
+#include <atomic>
+#include <string>
+#include <vector>
+#include "thirdparty/gtest/gtest.h"
+
+static void Append(std::vector<std::string>* log, const std::string& tag,
+                   const std::string& event) {
+  log->push_back(tag + ":" + event);
+}
+
+TEST(BroadcastCallbackTest, RunsSubscribersInOrder) {
+  std::vector<std::string> log;
+  BroadcastCallback<void(const std::string&)>* broadcast =
+      NewBroadcastCallback<void(const std::string&)>(3);
+  broadcast->Add(NewCallback(&Append, &log, std::string("a")));
+  broadcast->Add(NewCallback(&Append, &log, std::string("b")));
+  Callback<void(const std::string&)>* permanent =
+      NewPermanentCallback(&Append, &log, std::string("c"));
+  broadcast->Add(permanent);
+  EXPECT_EQ(3u, broadcast->size());
+  EXPECT_FALSE(broadcast->IsRepeatable());
+  broadcast->Run("done");
+  ASSERT_EQ(3u, log.size());
+  EXPECT_EQ("a:done", log[0]);
+  EXPECT_EQ("b:done", log[1]);
+  EXPECT_EQ("c:done", log[2]);
+  delete permanent;
+}
+
+TEST(BroadcastCallbackTest, NoSubscribers) {
+  NewBroadcastCallback<void()>(0)->Run();
+  NewBroadcastCallback<void(int)>(4)->Run(1);
+}
+
+TEST(BroadcastCallbackTest, DeleteWithoutRun) {
+  std::vector<std::string> log;
+  Callback<void(const std::string&)>* permanent =
+      NewPermanentCallback(&Append, &log, std::string("a"));
+  BroadcastCallback<void(const std::string&)>* broadcast =
+      NewBroadcastCallback<void(const std::string&)>(1);
+  broadcast->Add(permanent);
+  delete broadcast;
+  EXPECT_TRUE(log.empty());
+  delete permanent;
+}
+
+// Too big for CallbackPool, so the block comes from operator new.
+TEST(BroadcastCallbackTest, ManySubscribers) {
+  const int kSubscriberNum = 100;
+  std::vector<std::string> log;
+  BroadcastCallback<void(const std::string&)>* broadcast =
+      NewBroadcastCallback<void(const std::string&)>(kSubscriberNum);
+  for (int i = 0; i < kSubscriberNum; ++i) {
+    broadcast->Add(NewCallback(&Append, &log, std::to_string(i)));
+  }
+  broadcast->Run("x");
+  ASSERT_EQ(static_cast<size_t>(kSubscriberNum), log.size());
+  EXPECT_EQ("99:x", log.back());
+}
+
+struct Payload {
+  Payload() : copies(0) {}
+  Payload(const Payload& other) : copies(other.copies + 1) {}
+  int copies;
+};
+
+class PayloadSink {
+ public:
+  PayloadSink() : copies_(-1) {}
+  void Take(const Payload& payload) { copies_ = payload.copies; }
+  int copies() const { return copies_; }
+ private:
+  int copies_;
+};
+
+TEST(BroadcastCallbackTest, ConstReferencePayloadIsNotCopied) {
+  PayloadSink sinks[4];
+  BroadcastCallback<void(const Payload&)>* broadcast =
+      NewBroadcastCallback<void(const Payload&)>(4);
+  for (int i = 0; i < 4; ++i) {
+    broadcast->Add(NewCallback(&sinks[i], &PayloadSink::Take));
+  }
+  broadcast->Run(Payload());
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(0, sinks[i].copies());
+  }
+}
+
+static void Count(std::atomic<int>* count, const Payload& payload) {
+  count->fetch_add(1 + payload.copies * 100);
+}
+
+TEST(BroadcastCallbackTest, RunOnThreadPool) {
+  ThreadPool thread_pool(4);
+  std::atomic<int> count(0);
+  const int kSubscriberNum = 20;
+  BroadcastCallback<void(const Payload&)>* broadcast =
+      NewBroadcastCallback<void(const Payload&)>(kSubscriberNum,
+                                                 &thread_pool);
+  for (int i = 0; i < kSubscriberNum; ++i) {
+    broadcast->Add(NewCallback(&Count, &count));
+  }
+  {
+    Payload payload;
+    broadcast->Run(payload);
+  }
+  thread_pool.WaitForIdle();
+  // The payload is copied once into the broadcast, and shared from there.
+  EXPECT_EQ(kSubscriberNum * 101, count.load());
+}
@@ -4,24 +4,9 @@
 
 // Callback classes provides a generic interface for classes requiring
 // callback from other classes.
-// We support callbacks with 0, 1, 2, 3, and 4 arguments.
-//   Closure                  -- provides "void Run()"
-//   Callback<T1>            -- provides "void Run(T1)"
-//   Callback<T1,T2>         -- provides "void Run(T1, T2)"
-//   Callback<T1,T2,T3>      -- provides "void Run(T1, T2, T3)"
-//   Callback<T1,T2,T3,T4>   -- provides "void Run(T1, T2, T3, T4)"
-//
-// In addition, ResultCallback classes provide a generic interface for
-// callbacks that return a value.
-//   ResultCallback<R>              -- provides "R Run()"
-//   ResultCallback<R,T1>          -- provides "R Run(T1)"
-//   ResultCallback<R,T1,T2>       -- provides "R Run(T1, T2)"
-//   ResultCallback<R,T1,T2,T3>    -- provides "R Run(T1, T2, T3)"
-//   ResultCallback<R,T1,T2,T3,T4> -- provides "R Run(T1, T2, T3, T4)"
-//
-// If you want more than four arguments, you should extend
-// tools/generate-callback-specializations.py, or group some arguments
-// together into a structure.
+//   Closure                     -- provides "void Run()"
+//   Callback<R(A1, ..., An)>    -- provides "R Run(A1, ..., An)"
+// for any return type R (including void) and any number of arguments.
 //
 // We provide a convenient mechanism, NewCallback, for generating one of these
 // callbacks given an object pointer, a pointer to a member
@@ -44,23 +29,23 @@
 // often useful; a callback with no call-time arguments is a Closure.
 // See the examples below.
 //
-// WARNING:  In the current implementation (or perhaps with the current
-// compiler) NewCallback() is pickier about the types of pre-bound arguments
-// than you might expect.  The types must match exactly, rather than merely
-// being compatible.
-// For example, if you pre-bind an argument with the "const" specifier,
-// make sure that the actual parameter passed to NewCallback also has the
-// const specifier.   If you don't you'll get an error about
-// passing a your function "as argument 1 of NewCallback(void (*)())".
-// Using a method or function that has reference arguments among its pre-bound
-// arguments may not always work.
+// Pre-bound arguments are stored in the callback object by value, as their
+// own decayed type (not the parameter's, so binding a Derived to a
+// const Base& parameter doesn't slice it): an lvalue is copied in once and
+// an rvalue is moved in.  They are converted to the parameter type when the
+// callback runs.  When a NewCallback() callback runs, its pre-bound
+// arguments are moved on into the target (except for lvalue reference
+// parameters), so move-only types such as std::unique_ptr can be bound.  A
+// NewPermanentCallback() callback passes them as lvalues.
 //
 // Examples:
 //
 //   void Call0(Closure* cb) { cb->Run(); }
-//   void Call1(Callback<int>* cb, int a) { cb->Run(a); }
-//   void Call2(Callback<int, float>* cb, int a, float f) { cb->Run(a, f); }
-//   float Call3(ResultCallback<float, int>* cb, int a) { return cb->Run(a); }
+//   void Call1(Callback<void(int)>* cb, int a) { cb->Run(a); }
+//   void Call2(Callback<void(int, float)>* cb, int a, float f) {
+//     cb->Run(a, f);
+//   }
+//   float Call3(Callback<float(int)>* cb, int a) { return cb->Run(a); }
 //
 //   class Foo {
 //    public:
@@ -137,14 +122,16 @@
 //  ss.Loop();
 //  ...
 //
-//  The following WILL NOT WORK:
+//  Lambdas and other functors with a single operator() work as well; the
+//  callback signature is that of the operator(), and the captured state is
+//  stored in the callback object:
+//
+//   Callback<int(int)>* add = NewCallback([base](int a) { return base + a; });
+//   Closure* done = NewCallback([this, request]() { Finish(request); });
+//
+//  Pre-bound arguments only need to be convertible to the parameter type:
 //          NewCallback(F2, (char *) "Y") ->Run(10, 3.0f);
-//  It gets the error:
-//       passing `void (*)(const char *, int, float)' as argument 1 of
-//       `NewCallback(void (*)())'
-//  The problem is that "char *" is not an _exact_ match for
-//  "const char *", even though it's normally a legal implicit
-//  conversion.
+//  stores a "const char *".
 //
 //
 // The callback objects generated by NewCallback are self-deleting:
@@ -197,10 +184,10 @@
 //
 // Class B {
 //   public:
-//     void StartService(Callback<bool>* cb, other_args) : cb_(cb) { ...}
+//     void StartService(Callback<void(bool)>* cb, other_args) : cb_(cb) { ...}
 //     void FinishService(bool result) { ...; cb_->Run(result); }
 //   private:
-//     Callback<bool>* cb_;
+//     Callback<void(bool)>* cb_;
 // };
 //
 // As can be seen, B is completely independent of A. (Of course, they
@@ -0,0 +1,407 @@
+#include "common/base/callback.h"
+
+#include <stdlib.h>
+#include <atomic>
+#include <functional>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include "thirdparty/benchmark/benchmark.h"
+
+// Cost of Callback objects for each kind of target (member, const member
+// and plain function) and each split of up to three int arguments into
+// pre-bound and call-time ones, against std::function and a raw function
+// pointer making the same call:
+//
+//   BM_Callback<kind, permanent, pre, call>
+//     permanent: one NewPermanentCallback(), run every iteration;
+//     otherwise: NewCallback() and Run() (which deletes it) every iteration.
+//   BM_StdFunction<permanent, pre, call>
+//     the same with a std::function around a lambda capturing the target
+//     and the pre-bound arguments.
+//   BM_FunctionPointer<pre, call>
+//     a call through a function pointer, with all arguments at call time.
+//   BM_CrossThread<kind, pre> / BM_StdFunctionCrossThread<pre>
+//     closures created on one thread and run (and freed) on another,
+//     through a single producer single consumer ring.
+//
+// Every benchmark reports items_per_second, and "bytes": the memory each
+// callable takes.  For a Callback that is the block CallbackPool takes for
+// it, header and size class rounding included (operator new's, for objects
+// above CallbackPool::kMaxObjectSize); for a std::function, the bytes it
+// gets from operator new.  For regression tracking run it as
+//
+//   callback_benchmark --benchmark_format=json --benchmark_out=callback.json
+
+// Bytes handed out by operator new, all threads.  The replacements are
+// noinline so that GCC doesn't match the malloc() and free() inside them
+// against new and delete expressions.
+static std::atomic<size_t> g_heap_bytes(0);
+
+__attribute__((noinline))
+void* operator new(size_t size) {
+  g_heap_bytes.fetch_add(size, std::memory_order_relaxed);
+  void* object = malloc(size);
+  if (object == NULL) {
+    throw std::bad_alloc();
+  }
+  return object;
+}
+
+__attribute__((noinline))
+void operator delete(void* object) noexcept {
+  free(object);
+}
+
+__attribute__((noinline))
+void operator delete(void* object, size_t) noexcept {
+  free(object);
+}
+
+enum TargetKind {
+  kMember,
+  kConstMember,
+  kFunction,
+};
+
+static int Sum() {
+  return 0;
+}
+
+template <typename... Ints>
+static int Sum(int first, Ints... rest) {
+  return first + Sum(rest...);
+}
+
+class Target {
+ public:
+  Target() : sum_(0) {}
+  template <typename... Ints>
+  void Add(Ints... values) { sum_ += Sum(values...); }
+  template <typename... Ints>
+  void ConstAdd(Ints... values) const { sum_ += Sum(values...); }
+  int sum() const { return sum_; }
+ private:
+  mutable int sum_;
+};
+
+static int g_function_sum = 0;
+
+template <typename... Ints>
+static void FunctionAdd(Ints... values) {
+  g_function_sum += Sum(values...);
+}
+
+// Maps an index to an int parameter, to spell n ints from n indexes.
+template <size_t Index>
+struct IntParam {
+  typedef int type;
+};
+
+template <TargetKind Kind>
+struct TargetKindTag {};
+
+// Builds and runs the callables of a target taking sizeof...(Pre) +
+// sizeof...(Call) ints, the first sizeof...(Pre) of which are pre-bound.
+template <typename PreIndexes, typename CallIndexes>
+class ArgumentSplit;
+
+template <size_t... Pre, size_t... Call>
+class ArgumentSplit<CallbackIndexes<Pre...>, CallbackIndexes<Call...> > {
+ public:
+  typedef CallbackSignature<void, sizeof...(Pre),
+                            typename IntParam<Pre>::type...,
+                            typename IntParam<Call>::type...> Signature;
+  typedef typename Signature::CallbackType CallbackType;
+  // The pre-bound arguments New() stores.
+  typedef CallbackTypeList<typename IntParam<Pre>::type...> PreArgList;
+  typedef void (Target::*Member)(typename IntParam<Pre>::type...,
+                                 typename IntParam<Call>::type...);
+  typedef void (Target::*ConstMember)(typename IntParam<Pre>::type...,
+                                      typename IntParam<Call>::type...) const;
+  typedef void (*Function)(typename IntParam<Pre>::type...,
+                           typename IntParam<Call>::type...);
+  typedef std::function<void(typename IntParam<Call>::type...)> StdFunction;
+
+  static CallbackType* New(Target* target, bool permanent,
+                           TargetKindTag<kMember>) {
+    Member member = &Target::Add;
+    return permanent ?
+        NewPermanentCallback(target, member, static_cast<int>(Pre)...) :
+        NewCallback(target, member, static_cast<int>(Pre)...);
+  }
+
+  static CallbackType* New(Target* target, bool permanent,
+                           TargetKindTag<kConstMember>) {
+    const Target* const_target = target;
+    ConstMember member = &Target::ConstAdd;
+    return permanent ?
+        NewPermanentCallback(const_target, member, static_cast<int>(Pre)...) :
+        NewCallback(const_target, member, static_cast<int>(Pre)...);
+  }
+
+  static CallbackType* New(Target* target, bool permanent,
+                           TargetKindTag<kFunction>) {
+    Function function = &FunctionAdd;
+    return permanent ?
+        NewPermanentCallback(function, static_cast<int>(Pre)...) :
+        NewCallback(function, static_cast<int>(Pre)...);
+  }
+
+  // Bytes CallbackPool takes for the objects New() allocates.
+  template <bool SelfDelete>
+  static size_t BlockSize(TargetKindTag<kMember>) {
+    return CallbackPool::BlockSize(sizeof(MemberCallback<
+        SelfDelete, void, Target, Member, typename Signature::PreParamList,
+        PreArgList, CallbackType>));
+  }
+
+  template <bool SelfDelete>
+  static size_t BlockSize(TargetKindTag<kConstMember>) {
+    return CallbackPool::BlockSize(sizeof(ConstMemberCallback<
+        SelfDelete, void, Target, ConstMember,
+        typename Signature::PreParamList, PreArgList, CallbackType>));
+  }
+
+  template <bool SelfDelete>
+  static size_t BlockSize(TargetKindTag<kFunction>) {
+    return CallbackPool::BlockSize(sizeof(FunctionCallback<
+        SelfDelete, void, Function, typename Signature::PreParamList,
+        PreArgList, CallbackType>));
+  }
+
+  static StdFunction NewStdFunction(Target* target) {
+    return Bind(target, static_cast<int>(Pre)...);
+  }
+
+  static void Run(CallbackType* callback) {
+    callback->Run(static_cast<int>(Call)...);
+  }
+
+  static void Run(const StdFunction& function) {
+    function(static_cast<int>(Call)...);
+  }
+
+  static void Run(Function function) {
+    function(static_cast<int>(Pre)..., static_cast<int>(Call)...);
+  }
+
+ private:
+  static StdFunction Bind(Target* target,
+                          typename IntParam<Pre>::type... pre_args) {
+    return [target, pre_args...](typename IntParam<Call>::type... args) {
+      target->Add(pre_args..., args...);
+    };
+  }
+};
+
+template <size_t NumPre, size_t NumCall>
+struct SplitOf {
+  typedef ArgumentSplit<typename MakeCallbackIndexes<NumPre>::type,
+                        typename MakeCallbackIndexes<NumCall>::type> type;
+};
+
+template <TargetKind Kind, bool Permanent, size_t NumPre, size_t NumCall>
+static void BM_Callback(benchmark::State& state) {
+  typedef typename SplitOf<NumPre, NumCall>::type Split;
+  typedef typename Split::CallbackType CallbackType;
+  Target target;
+  if (Permanent) {
+    CallbackType* callback =
+        Split::New(&target, true, TargetKindTag<Kind>());
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(callback);
+      Split::Run(callback);
+    }
+    delete callback;
+  } else {
+    for (auto _ : state) {
+      CallbackType* callback =
+          Split::New(&target, false, TargetKindTag<Kind>());
+      benchmark::DoNotOptimize(callback);
+      Split::Run(callback);
+    }
+  }
+  benchmark::DoNotOptimize(target.sum());
+  benchmark::DoNotOptimize(g_function_sum);
+  state.SetItemsProcessed(state.iterations());
+  state.counters["bytes"] =
+      Split::template BlockSize<!Permanent>(TargetKindTag<Kind>());
+}
+
+template <bool Permanent, size_t NumPre, size_t NumCall>
+static void BM_StdFunction(benchmark::State& state) {
+  typedef typename SplitOf<NumPre, NumCall>::type Split;
+  typedef typename Split::StdFunction StdFunction;
+  Target target;
+  size_t heap_bytes = g_heap_bytes.load(std::memory_order_relaxed);
+  size_t created = 1;
+  if (Permanent) {
+    StdFunction function = Split::NewStdFunction(&target);
+    heap_bytes = g_heap_bytes.load(std::memory_order_relaxed) - heap_bytes;
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(function);
+      Split::Run(function);
+    }
+  } else {
+    for (auto _ : state) {
+      StdFunction function = Split::NewStdFunction(&target);
+      benchmark::DoNotOptimize(function);
+      Split::Run(function);
+    }
+    heap_bytes = g_heap_bytes.load(std::memory_order_relaxed) - heap_bytes;
+    created = state.iterations();
+  }
+  benchmark::DoNotOptimize(target.sum());
+  state.SetItemsProcessed(state.iterations());
+  state.counters["bytes"] = static_cast<double>(heap_bytes) / created;
+}
+
+template <size_t NumPre, size_t NumCall>
+static void BM_FunctionPointer(benchmark::State& state) {
+  typedef typename SplitOf<NumPre, NumCall>::type Split;
+  typename Split::Function function = &FunctionAdd;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(function);
+    Split::Run(function);
+  }
+  benchmark::DoNotOptimize(g_function_sum);
+  state.SetItemsProcessed(state.iterations());
+  state.counters["bytes"] = 0;
+}
+
+// Hands values from one producer thread to one consumer thread.
+template <typename T>
+class SpscRing {
+ public:
+  SpscRing() : head_(0), tail_(0) {}
+
+  // Producer only; waits while the ring is full.
+  void Push(T&& value) {
+    size_t tail = tail_.load(std::memory_order_relaxed);
+    while (tail - head_.load(std::memory_order_acquire) == kCapacity) {
+      std::this_thread::yield();
+    }
+    slots_[tail % kCapacity] = std::move(value);
+    tail_.store(tail + 1, std::memory_order_release);
+  }
+
+  // Consumer only.
+  bool Pop(T* value) {
+    size_t head = head_.load(std::memory_order_relaxed);
+    if (head == tail_.load(std::memory_order_acquire)) {
+      return false;
+    }
+    *value = std::move(slots_[head % kCapacity]);
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+ private:
+  static const size_t kCapacity = 256;
+
+  alignas(64) std::atomic<size_t> head_;
+  alignas(64) std::atomic<size_t> tail_;
+  T slots_[kCapacity];
+};
+
+static void RunTask(Closure* closure) {
+  closure->Run();
+}
+
+static void RunTask(std::function<void()>& function) {
+  function();
+  function = nullptr;
+}
+
+template <typename T>
+static void RunUntilDone(SpscRing<T>* ring, const std::atomic<bool>* done) {
+  T task;
+  for (;;) {
+    if (ring->Pop(&task)) {
+      RunTask(task);
+    } else if (done->load(std::memory_order_acquire)) {
+      if (!ring->Pop(&task)) {
+        return;
+      }
+      RunTask(task);
+    } else {
+      std::this_thread::yield();
+    }
+  }
+}
+
+template <TargetKind Kind, size_t NumPre>
+static void BM_CrossThread(benchmark::State& state) {
+  typedef typename SplitOf<NumPre, 0>::type Split;
+  Target target;
+  SpscRing<Closure*> ring;
+  std::atomic<bool> done(false);
+  std::thread consumer(&RunUntilDone<Closure*>, &ring, &done);
+  for (auto _ : state) {
+    ring.Push(Split::New(&target, false, TargetKindTag<Kind>()));
+  }
+  done.store(true, std::memory_order_release);
+  consumer.join();
+  benchmark::DoNotOptimize(target.sum());
+  state.SetItemsProcessed(state.iterations());
+  state.counters["bytes"] =
+      Split::template BlockSize<true>(TargetKindTag<Kind>());
+}
+
+template <size_t NumPre>
+static void BM_StdFunctionCrossThread(benchmark::State& state) {
+  typedef typename SplitOf<NumPre, 0>::type Split;
+  Target target;
+  SpscRing<std::function<void()> > ring;
+  std::atomic<bool> done(false);
+  std::thread consumer(&RunUntilDone<std::function<void()> >, &ring,
+                       &done);
+  size_t heap_bytes = g_heap_bytes.load(std::memory_order_relaxed);
+  for (auto _ : state) {
+    ring.Push(Split::NewStdFunction(&target));
+  }
+  heap_bytes = g_heap_bytes.load(std::memory_order_relaxed) - heap_bytes;
+  done.store(true, std::memory_order_release);
+  consumer.join();
+  benchmark::DoNotOptimize(target.sum());
+  state.SetItemsProcessed(state.iterations());
+  state.counters["bytes"] =
+      static_cast<double>(heap_bytes) / state.iterations();
+}
+
+#define SINGLE_THREAD_BENCHMARKS(pre, call)                       \
+  BENCHMARK_TEMPLATE(BM_Callback, kMember, false, pre, call);       \
+  BENCHMARK_TEMPLATE(BM_Callback, kMember, true, pre, call);        \
+  BENCHMARK_TEMPLATE(BM_Callback, kConstMember, false, pre, call);  \
+  BENCHMARK_TEMPLATE(BM_Callback, kConstMember, true, pre, call);   \
+  BENCHMARK_TEMPLATE(BM_Callback, kFunction, false, pre, call);     \
+  BENCHMARK_TEMPLATE(BM_Callback, kFunction, true, pre, call);      \
+  BENCHMARK_TEMPLATE(BM_StdFunction, false, pre, call);             \
+  BENCHMARK_TEMPLATE(BM_StdFunction, true, pre, call);              \
+  BENCHMARK_TEMPLATE(BM_FunctionPointer, pre, call)
+
+SINGLE_THREAD_BENCHMARKS(0, 0);
+SINGLE_THREAD_BENCHMARKS(0, 1);
+SINGLE_THREAD_BENCHMARKS(1, 0);
+SINGLE_THREAD_BENCHMARKS(0, 2);
+SINGLE_THREAD_BENCHMARKS(1, 1);
+SINGLE_THREAD_BENCHMARKS(2, 0);
+SINGLE_THREAD_BENCHMARKS(0, 3);
+SINGLE_THREAD_BENCHMARKS(1, 2);
+SINGLE_THREAD_BENCHMARKS(2, 1);
+SINGLE_THREAD_BENCHMARKS(3, 0);
+
+// Timed in real time, since most of the work is on the consumer thread.
+#define CROSS_THREAD_BENCHMARKS(pre)                                  \
+  BENCHMARK_TEMPLATE(BM_CrossThread, kMember, pre)->UseRealTime();      \
+  BENCHMARK_TEMPLATE(BM_CrossThread, kConstMember, pre)->UseRealTime(); \
+  BENCHMARK_TEMPLATE(BM_CrossThread, kFunction, pre)->UseRealTime();    \
+  BENCHMARK_TEMPLATE(BM_StdFunctionCrossThread, pre)->UseRealTime()
+
+CROSS_THREAD_BENCHMARKS(0);
+CROSS_THREAD_BENCHMARKS(1);
+CROSS_THREAD_BENCHMARKS(2);
+CROSS_THREAD_BENCHMARKS(3);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,208 @@
+#include "common/base/callback_pool.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+namespace {
+
+// Objects are served in multiples of kAlignment bytes, and each of them is
+// preceded by a kAlignment-sized BlockHeader so it stays 16-byte aligned.
+const size_t kAlignment = 16;
+const size_t kNumSizeClasses = CallbackPool::kMaxObjectSize / kAlignment;
+// Free blocks a thread keeps per size class; the rest go back to malloc.
+const size_t kMaxCachedBlocks = 4096;
+
+class ThreadCache;
+
+struct BlockHeader {
+  ThreadCache* owner;
+  size_t size_class;
+};
+
+static_assert(sizeof(BlockHeader) <= kAlignment,
+              "BlockHeader must fit in the alignment padding");
+
+// Overlays the object memory while the block is on a free list.
+struct FreeBlock {
+  FreeBlock* next;
+};
+
+inline BlockHeader* HeaderOf(void* object) {
+  return reinterpret_cast<BlockHeader*>(
+      static_cast<char*>(object) - kAlignment);
+}
+
+inline void* ObjectOf(BlockHeader* header) {
+  return reinterpret_cast<char*>(header) + kAlignment;
+}
+
+inline size_t SizeClassOf(size_t size) {
+  return size == 0 ? 0 : (size - 1) / kAlignment;
+}
+
+inline size_t BlockSizeOf(size_t size_class) {
+  return kAlignment + (size_class + 1) * kAlignment;
+}
+
+class ThreadCache {
+ public:
+  ThreadCache() : next_parked(NULL), remote_frees_(NULL) {
+    for (size_t i = 0; i < kNumSizeClasses; ++i) {
+      free_lists_[i] = NULL;
+      free_counts_[i] = 0;
+    }
+  }
+
+  // Owner thread only.
+  void* Allocate(size_t size_class) {
+    if (free_lists_[size_class] == NULL) {
+      ReclaimRemoteFrees();
+    }
+    FreeBlock* block = free_lists_[size_class];
+    if (block != NULL) {
+      free_lists_[size_class] = block->next;
+      --free_counts_[size_class];
+      return block;
+    }
+    BlockHeader* header =
+        static_cast<BlockHeader*>(malloc(BlockSizeOf(size_class)));
+    if (header == NULL) {
+      throw std::bad_alloc();
+    }
+    header->owner = this;
+    header->size_class = size_class;
+    return ObjectOf(header);
+  }
+
+  // Owner thread only.
+  void FreeLocal(void* object, size_t size_class) {
+    if (free_counts_[size_class] >= kMaxCachedBlocks) {
+      free(HeaderOf(object));
+      return;
+    }
+    FreeBlock* block = static_cast<FreeBlock*>(object);
+    block->next = free_lists_[size_class];
+    free_lists_[size_class] = block;
+    ++free_counts_[size_class];
+  }
+
+  // Any thread.  The owner only ever takes the whole list at once, so a
+  // plain CAS push is free of ABA problems.
+  void FreeRemote(void* object) {
+    FreeBlock* block = static_cast<FreeBlock*>(object);
+    FreeBlock* head = remote_frees_.load(std::memory_order_relaxed);
+    do {
+      block->next = head;
+    } while (!remote_frees_.compare_exchange_weak(
+        head, block, std::memory_order_release, std::memory_order_relaxed));
+  }
+
+  // Owner thread only.
+  void ReclaimRemoteFrees() {
+    FreeBlock* block = remote_frees_.exchange(NULL, std::memory_order_acquire);
+    while (block != NULL) {
+      FreeBlock* next = block->next;
+      FreeLocal(block, HeaderOf(block)->size_class);
+      block = next;
+    }
+  }
+
+  // Gives all cached blocks back to malloc when the owner thread exits.
+  // Blocks still in use stay owned by this cache.
+  void Release() {
+    ReclaimRemoteFrees();
+    for (size_t i = 0; i < kNumSizeClasses; ++i) {
+      while (free_lists_[i] != NULL) {
+        FreeBlock* block = free_lists_[i];
+        free_lists_[i] = block->next;
+        free(HeaderOf(block));
+      }
+      free_counts_[i] = 0;
+    }
+  }
+
+  ThreadCache* next_parked;
+
+ private:
+  FreeBlock* free_lists_[kNumSizeClasses];
+  size_t free_counts_[kNumSizeClasses];
+  std::atomic<FreeBlock*> remote_frees_;
+};
+
+__thread ThreadCache* t_cache = NULL;
+
+pthread_once_t g_cache_key_once = PTHREAD_ONCE_INIT;
+pthread_key_t g_cache_key;
+
+// Caches of exited threads, waiting to be adopted by new threads.
+// Never freed: other threads may still free blocks owned by them.
+pthread_mutex_t g_parked_mutex = PTHREAD_MUTEX_INITIALIZER;
+ThreadCache* g_parked_caches = NULL;
+
+void ParkThreadCache(void* arg) {
+  ThreadCache* cache = static_cast<ThreadCache*>(arg);
+  t_cache = NULL;
+  cache->Release();
+  pthread_mutex_lock(&g_parked_mutex);
+  cache->next_parked = g_parked_caches;
+  g_parked_caches = cache;
+  pthread_mutex_unlock(&g_parked_mutex);
+}
+
+void CreateCacheKey() {
+  pthread_key_create(&g_cache_key, &ParkThreadCache);
+}
+
+ThreadCache* GetThreadCache() {
+  if (t_cache != NULL) {
+    return t_cache;
+  }
+  pthread_once(&g_cache_key_once, &CreateCacheKey);
+  pthread_mutex_lock(&g_parked_mutex);
+  ThreadCache* cache = g_parked_caches;
+  if (cache != NULL) {
+    g_parked_caches = cache->next_parked;
+    cache->next_parked = NULL;
+  }
+  pthread_mutex_unlock(&g_parked_mutex);
+  if (cache == NULL) {
+    cache = new ThreadCache;
+  }
+  pthread_setspecific(g_cache_key, cache);
+  t_cache = cache;
+  return cache;
+}
+
+}  // namespace
+
+void* CallbackPool::Allocate(size_t size) {
+  if (size > kMaxObjectSize) {
+    return ::operator new(size);
+  }
+  return GetThreadCache()->Allocate(SizeClassOf(size));
+}
+
+void CallbackPool::Deallocate(void* object, size_t size) {
+  if (object == NULL) {
+    return;
+  }
+  if (size > kMaxObjectSize) {
+    ::operator delete(object);
+    return;
+  }
+  BlockHeader* header = HeaderOf(object);
+  if (header->owner == t_cache) {
+    header->owner->FreeLocal(object, header->size_class);
+  } else {
+    header->owner->FreeRemote(object);
+  }
+}
+
+size_t CallbackPool::BlockSize(size_t size) {
+  if (size > kMaxObjectSize) {
+    return size;
+  }
+  return BlockSizeOf(SizeClassOf(size));
+}
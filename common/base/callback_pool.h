@@ -0,0 +1,53 @@
+#ifndef COMMON_BASE_CALLBACK_POOL_H_
+#define COMMON_BASE_CALLBACK_POOL_H_
+
+#include <stddef.h>
+
+// CallbackPool recycles the memory of heap-allocated callback objects.
+//
+// Every Callback<> class routes its operator new/delete here, so the objects
+// created by NewCallback()/NewPermanentCallback() and deleted by
+// CallbackAutoDeleter after Run() do not go to malloc in steady state.
+//
+// Memory is kept in per-thread caches with one free list per size class.
+// A block freed on the thread which allocated it goes straight back to that
+// thread's free list.  A block freed on another thread (the usual case for
+// completion callbacks run by I/O threads) is pushed onto its owner's
+// lock-free remote free list, and the owner takes the whole list back the
+// next time its local free list for that size runs dry.
+//
+// When a thread exits its cache is parked, and the next new thread adopts
+// it together with anything other threads have freed into it meanwhile.
+//
+// Objects larger than kMaxObjectSize bytes bypass the pool.
+class CallbackPool {
+ public:
+  static const size_t kMaxObjectSize = 256;
+
+  static void* Allocate(size_t size);
+  // size must be the size passed to Allocate().
+  static void Deallocate(void* object, size_t size);
+
+  // Bytes Allocate(size) takes from malloc (or operator new, above
+  // kMaxObjectSize), the block header and size class rounding included.
+  static size_t BlockSize(size_t size);
+};
+
+// Base of all Callback<> classes, routing their operator new/delete (and so
+// NewCallback() and CallbackAutoDeleter) to CallbackPool.
+class CallbackPoolObject {
+ public:
+  static void* operator new(size_t size) {
+    return CallbackPool::Allocate(size);
+  }
+  static void operator delete(void* object, size_t size) {
+    CallbackPool::Deallocate(object, size);
+  }
+  // Keep placement new usable on callback classes.
+  static void* operator new(size_t, void* place) {
+    return place;
+  }
+  static void operator delete(void*, void*) {}
+};
+
+#endif  // COMMON_BASE_CALLBACK_POOL_H_
@@ -0,0 +1,133 @@
+#include "common/base/callback_pool.h"
+
+#include <algorithm>
+#include <vector>
+#include "common/base/callback.h"
+#include "thirdparty/gtest/gtest.h"
+
+static void DoInc(int* i) {
+  ++(*i);
+}
+
+static void FreeAll(std::vector<void*>* blocks, size_t size) {
+  for (size_t i = 0; i < blocks->size(); ++i) {
+    CallbackPool::Deallocate((*blocks)[i], size);
+  }
+}
+
+static void AllocateAll(std::vector<void*>* blocks, size_t size) {
+  for (size_t i = 0; i < blocks->size(); ++i) {
+    (*blocks)[i] = CallbackPool::Allocate(size);
+  }
+}
+
+TEST(CallbackPoolTest, SameThreadReuse) {
+  void* p = CallbackPool::Allocate(40);
+  CallbackPool::Deallocate(p, 40);
+  // 40 and 48 bytes share a size class.
+  void* q = CallbackPool::Allocate(48);
+  EXPECT_EQ(p, q);
+  CallbackPool::Deallocate(q, 48);
+}
+
+TEST(CallbackPoolTest, Alignment) {
+  for (size_t size = 1; size <= CallbackPool::kMaxObjectSize; ++size) {
+    void* p = CallbackPool::Allocate(size);
+    EXPECT_EQ(0u, reinterpret_cast<size_t>(p) % 16);
+    CallbackPool::Deallocate(p, size);
+  }
+}
+
+TEST(CallbackPoolTest, LargeObjectBypassesPool) {
+  const size_t kSize = CallbackPool::kMaxObjectSize + 1;
+  char* p = static_cast<char*>(CallbackPool::Allocate(kSize));
+  std::fill(p, p + kSize, 'x');
+  CallbackPool::Deallocate(p, kSize);
+}
+
+TEST(CallbackPoolTest, BlockSize) {
+  // A 16 byte header, plus the object rounded up to 16 bytes.
+  EXPECT_EQ(32u, CallbackPool::BlockSize(1));
+  EXPECT_EQ(32u, CallbackPool::BlockSize(16));
+  EXPECT_EQ(48u, CallbackPool::BlockSize(17));
+  EXPECT_EQ(CallbackPool::kMaxObjectSize + 16,
+            CallbackPool::BlockSize(CallbackPool::kMaxObjectSize));
+  // Straight from operator new.
+  EXPECT_EQ(CallbackPool::kMaxObjectSize + 1,
+            CallbackPool::BlockSize(CallbackPool::kMaxObjectSize + 1));
+}
+
+TEST(CallbackPoolTest, NewCallbackRecyclesMemory) {
+  int i = 0;
+  Closure* first = NewCallback(&DoInc, &i);
+  void* address = first;
+  first->Run();
+  Closure* second = NewCallback(&DoInc, &i);
+  EXPECT_EQ(address, static_cast<void*>(second));
+  second->Run();
+  EXPECT_EQ(2, i);
+}
+
+TEST(CallbackPoolTest, CrossThreadFreeReturnsToOwner) {
+  const size_t kSize = 64;
+  std::vector<void*> blocks(1000);
+  AllocateAll(&blocks, kSize);
+  std::vector<void*> allocated = blocks;
+
+  Thread thread(NewCallback(&FreeAll, &blocks, kSize));
+  thread.Start();
+  thread.Join();
+
+  AllocateAll(&blocks, kSize);
+  std::sort(allocated.begin(), allocated.end());
+  std::sort(blocks.begin(), blocks.end());
+  EXPECT_TRUE(allocated == blocks);
+  FreeAll(&blocks, kSize);
+}
+
+TEST(CallbackPoolTest, FreeAfterOwnerThreadExit) {
+  const size_t kSize = 32;
+  std::vector<void*> blocks(1000);
+  Thread owner(NewCallback(&AllocateAll, &blocks, kSize));
+  owner.Start();
+  owner.Join();
+  FreeAll(&blocks, kSize);
+
+  // A new thread adopts the parked cache along with the freed blocks.
+  Thread adopter(NewCallback(&AllocateAll, &blocks, kSize));
+  adopter.Start();
+  adopter.Join();
+  FreeAll(&blocks, kSize);
+}
+
+static void RunAll(std::vector<Closure*>* closures) {
+  for (size_t i = 0; i < closures->size(); ++i) {
+    (*closures)[i]->Run();
+  }
+}
+
+// Closures created on this thread and run (so freed) on others.
+TEST(CallbackPoolTest, ClosuresRunOnOtherThreads) {
+  const int kThreadNum = 8;
+  const int kClosureNum = 10000;
+  const int kRoundNum = 3;
+  int counts[kThreadNum] = { 0 };
+  std::vector<std::vector<Closure*> > closures(kThreadNum);
+  for (int round = 0; round < kRoundNum; ++round) {
+    std::vector<shared_ptr<Thread> > threads(kThreadNum);
+    for (int t = 0; t < kThreadNum; ++t) {
+      closures[t].clear();
+      for (int k = 0; k < kClosureNum; ++k) {
+        closures[t].push_back(NewCallback(&DoInc, &counts[t]));
+      }
+      threads[t].reset(new Thread(NewCallback(&RunAll, &closures[t])));
+      threads[t]->Start();
+    }
+    for (int t = 0; t < kThreadNum; ++t) {
+      threads[t]->Join();
+    }
+  }
+  for (int t = 0; t < kThreadNum; ++t) {
+    EXPECT_EQ(kRoundNum * kClosureNum, counts[t]);
+  }
+}
@@ -0,0 +1,97 @@
+#ifndef COMMON_BASE_CALLBACK_REF_H_
+#define COMMON_BASE_CALLBACK_REF_H_
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include "common/base/callback.h"
+
+// CallbackRef<R(Args...)> refers to something callable as R(Args...) without
+// owning it: a lambda, a functor, a function pointer or a Callback<>.  It is
+// two words (a pointer to the target and a trampoline function), is built
+// without any allocation, and is meant to be passed by value down the stack
+// to code which calls it synchronously and doesn't keep it:
+//
+//   void ForEachAction(CallbackRef<void(RpcAction*)> visit);
+//
+//   int count = 0;
+//   ForEachAction([&count](RpcAction* action) { ++count; });
+//
+// The target must outlive every call through the CallbackRef; binding a
+// temporary lambda is fine when the CallbackRef is only used during the
+// call it is passed to.  Never store a CallbackRef, store a Callback instead.
+//
+// A CallbackRef built from a Callback<>* calls its Run(), so one made from a
+// NewCallback() callback may be called once only, which deletes the
+// callback.
+template <typename Signature>
+class CallbackRef;
+
+template <typename R, typename... Args>
+class CallbackRef<R(Args...)> {
+ public:
+  // From a lambda or functor, which is referred to, not copied.
+  template <typename Functor>
+  CallbackRef(Functor&& functor,  // NOLINT(runtime/explicit)
+              typename std::enable_if<
+                  !std::is_same<typename std::decay<Functor>::type,
+                                CallbackRef>::value &&
+                  !std::is_pointer<
+                      typename std::decay<Functor>::type>::value>::type* = 0)
+      : trampoline_(&InvokeFunctor<
+                        typename std::remove_reference<Functor>::type>) {
+    target_.object = const_cast<void*>(
+        static_cast<const volatile void*>(std::addressof(functor)));
+  }
+
+  // From a function pointer, which is copied.
+  template <typename Result, typename... Params>
+  CallbackRef(Result (*function)(Params...))  // NOLINT(runtime/explicit)
+      : trampoline_(&InvokeFunction<Result (*)(Params...)>) {
+    target_.function = reinterpret_cast<void (*)()>(function);
+  }
+
+  // From a Callback<R(Args...)>, or anything derived from it.
+  CallbackRef(Callback<R(Args...)>* callback)  // NOLINT(runtime/explicit)
+      : trampoline_(&InvokeCallback) {
+    target_.object = callback;
+  }
+
+  R Run(Args... args) const {
+    return trampoline_(target_, std::forward<Args>(args)...);
+  }
+
+  R operator()(Args... args) const {
+    return trampoline_(target_, std::forward<Args>(args)...);
+  }
+
+ private:
+  union Target {
+    void* object;
+    void (*function)();
+  };
+
+  typedef R (*Trampoline)(Target target, Args... args);
+
+  template <typename Functor>
+  static R InvokeFunctor(Target target, Args... args) {
+    return static_cast<R>((*static_cast<Functor*>(target.object))(
+        std::forward<Args>(args)...));
+  }
+
+  template <typename FunctionType>
+  static R InvokeFunction(Target target, Args... args) {
+    return static_cast<R>(reinterpret_cast<FunctionType>(target.function)(
+        std::forward<Args>(args)...));
+  }
+
+  static R InvokeCallback(Target target, Args... args) {
+    return static_cast<Callback<R(Args...)>*>(target.object)->Run(
+        std::forward<Args>(args)...);
+  }
+
+  Target target_;
+  Trampoline trampoline_;
+};
+
+#endif  // COMMON_BASE_CALLBACK_REF_H_
@@ -0,0 +1,98 @@
+#include "common/base/callback_ref.h"
+
+#include <functional>
+#include "common/base/callback.h"
+#include "thirdparty/benchmark/benchmark.h"
+
+// Cost of handing a callable to a function which runs it synchronously,
+// including building whatever wraps the callable.
+
+class Accumulator {
+ public:
+  Accumulator() : sum_(0) {}
+  void Add(int a) { sum_ += a; }
+  int sum() const { return sum_; }
+ private:
+  int sum_;
+};
+
+__attribute__((noinline))
+static void CallRef(CallbackRef<void(int)> f, int a) {
+  f(a);
+}
+
+__attribute__((noinline))
+static void CallFunction(const std::function<void(int)>& f, int a) {
+  f(a);
+}
+
+__attribute__((noinline))
+static void CallCallback(Callback<void(int)>* f, int a) {
+  f->Run(a);
+}
+
+static void BM_CallbackRef(benchmark::State& state) {
+  Accumulator accumulator;
+  for (auto _ : state) {
+    CallRef([&accumulator](int a) { accumulator.Add(a); }, 1);
+  }
+  benchmark::DoNotOptimize(accumulator.sum());
+}
+BENCHMARK(BM_CallbackRef);
+
+// Captures more than fits in std::function's small buffer.
+static void BM_CallbackRefLargeCapture(benchmark::State& state) {
+  Accumulator accumulator;
+  int a = 1, b = 2, c = 3;
+  for (auto _ : state) {
+    CallRef([&accumulator, a, b, c](int x) {
+      accumulator.Add(x + a + b + c);
+    }, 1);
+  }
+  benchmark::DoNotOptimize(accumulator.sum());
+}
+BENCHMARK(BM_CallbackRefLargeCapture);
+
+static void BM_CallbackRefFromPermanentCallback(benchmark::State& state) {
+  Accumulator accumulator;
+  Callback<void(int)>* callback =
+      NewPermanentCallback(&accumulator, &Accumulator::Add);
+  for (auto _ : state) {
+    CallRef(callback, 1);
+  }
+  delete callback;
+  benchmark::DoNotOptimize(accumulator.sum());
+}
+BENCHMARK(BM_CallbackRefFromPermanentCallback);
+
+static void BM_StdFunction(benchmark::State& state) {
+  Accumulator accumulator;
+  for (auto _ : state) {
+    CallFunction([&accumulator](int a) { accumulator.Add(a); }, 1);
+  }
+  benchmark::DoNotOptimize(accumulator.sum());
+}
+BENCHMARK(BM_StdFunction);
+
+static void BM_StdFunctionLargeCapture(benchmark::State& state) {
+  Accumulator accumulator;
+  int a = 1, b = 2, c = 3;
+  for (auto _ : state) {
+    CallFunction([&accumulator, a, b, c](int x) {
+      accumulator.Add(x + a + b + c);
+    }, 1);
+  }
+  benchmark::DoNotOptimize(accumulator.sum());
+}
+BENCHMARK(BM_StdFunctionLargeCapture);
+
+static void BM_NewCallbackRun(benchmark::State& state) {
+  Accumulator accumulator;
+  for (auto _ : state) {
+    CallCallback(NewCallback(&accumulator, &Accumulator::Add), 1);
+  }
+  benchmark::DoNotOptimize(accumulator.sum());
+}
+BENCHMARK(BM_NewCallbackRun);
+
+BENCHMARK_MAIN();
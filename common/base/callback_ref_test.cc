@@ -0,0 +1,93 @@
+#include "common/base/callback_ref.h"
+
+#include <string>
+#include "thirdparty/gtest/gtest.h"
+
+static int Twice(int a) {
+  return 2 * a;
+}
+
+static int Apply(CallbackRef<int(int)> f, int a) {
+  return f(a);
+}
+
+static void Repeat(int n, CallbackRef<void()> f) {
+  for (int i = 0; i < n; ++i) {
+    f.Run();
+  }
+}
+
+struct Adder {
+  int operator()(int a) const { return a + base; }
+  int base;
+};
+
+class Counter {
+ public:
+  Counter() : count_(0) {}
+  void Inc() { ++count_; }
+  int Add(int n) {
+    count_ += n;
+    return count_;
+  }
+  int count() const { return count_; }
+ private:
+  int count_;
+};
+
+TEST(CallbackRefTest, Lambda) {
+  int calls = 0;
+  Repeat(3, [&calls]() { ++calls; });
+  EXPECT_EQ(3, calls);
+  EXPECT_EQ(7, Apply([](int a) { return a + 1; }, 6));
+}
+
+TEST(CallbackRefTest, Functor) {
+  Adder adder = { 10 };
+  EXPECT_EQ(11, Apply(adder, 1));
+  const Adder const_adder = { 20 };
+  EXPECT_EQ(21, Apply(const_adder, 1));
+}
+
+TEST(CallbackRefTest, FunctionPointer) {
+  EXPECT_EQ(8, Apply(&Twice, 4));
+  EXPECT_EQ(8, Apply(Twice, 4));
+}
+
+TEST(CallbackRefTest, PermanentCallback) {
+  Counter counter;
+  Closure* closure = NewPermanentCallback(&counter, &Counter::Inc);
+  Repeat(5, closure);
+  EXPECT_EQ(5, counter.count());
+  delete closure;
+
+  Callback<int(int)>* callback =
+      NewPermanentCallback(&counter, &Counter::Add);
+  EXPECT_EQ(7, Apply(callback, 2));
+  delete callback;
+}
+
+TEST(CallbackRefTest, SelfDeletingCallbackRunsOnce) {
+  Counter counter;
+  Repeat(1, NewCallback(&counter, &Counter::Inc));
+  EXPECT_EQ(1, counter.count());
+}
+
+TEST(CallbackRefTest, CopiesReferToTheSameTarget) {
+  int calls = 0;
+  auto inc = [&calls]() { ++calls; };
+  CallbackRef<void()> ref(inc);
+  CallbackRef<void()> copy = ref;
+  ref();
+  copy();
+  EXPECT_EQ(2, calls);
+}
+
+TEST(CallbackRefTest, ResultConversion) {
+  // The result of the target may be dropped or converted.
+  CallbackRef<void(int)> drop(&Twice);
+  drop(1);
+  auto make_string = []() { return "abc"; };
+  CallbackRef<std::string()> convert(make_string);
+  EXPECT_EQ("abc", convert());
+}
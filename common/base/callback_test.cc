@@ -1,6 +1,7 @@
 
 #include "common/base/callback.h"
 
+#include <memory>
 #include <string>
 #include "thirdparty/glog/logging.h"
 #include "thirdparty/gtest/gtest.h"
@@ -412,3 +413,225 @@ TEST_F(CallbackTest, TestConstReferenceArg) {
   // s should be bind by value, but pass by const reference
   ASSERT_NE(&s, c->Run());
 }
+
+static int SumOfEight(int a1, int a2, int a3, int a4,
+                      int a5, int a6, int a7, int a8) {
+  return a1 + a2 + a3 + a4 + a5 + a6 + a7 + a8;
+}
+
+TEST_F(CallbackTest, TestManyArguments) {
+  Callback<int(int, int, int)>* c =
+      NewCallback(&SumOfEight, 1, 2, 3, 4, 5);
+  EXPECT_EQ(36, c->Run(6, 7, 8));
+  Callback<int(int, int, int, int, int, int, int, int)>* p =
+      NewPermanentCallback(&SumOfEight);
+  EXPECT_EQ(8, p->Run(1, 1, 1, 1, 1, 1, 1, 1));
+  delete p;
+}
+
+// Counts how often it gets copied.
+struct CopyCounter {
+  CopyCounter() : copies(0) {}
+  CopyCounter(const CopyCounter& other) : copies(other.copies + 1) {}
+  CopyCounter(CopyCounter&& other) : copies(other.copies) {}
+  int copies;
+};
+
+class CopyCounterSink {
+ public:
+  CopyCounterSink() : copies_(-1) {}
+  void Take(const CopyCounter& counter) { copies_ = counter.copies; }
+  int copies() const { return copies_; }
+ private:
+  int copies_;
+};
+
+TEST_F(CallbackTest, TestPreBoundArgumentsAreNotCopiedTwice) {
+  CopyCounterSink sink;
+  CopyCounter counter;
+  // An lvalue is copied into the callback once, and not again by Run().
+  NewCallback(&sink, &CopyCounterSink::Take, counter)->Run();
+  EXPECT_EQ(1, sink.copies());
+  // An rvalue is moved in.
+  NewCallback(&sink, &CopyCounterSink::Take, CopyCounter())->Run();
+  EXPECT_EQ(0, sink.copies());
+}
+
+static int TakeOwnership(std::unique_ptr<int> value, int add) {
+  return *value + add;
+}
+
+static int PeekOwnership(const std::unique_ptr<int>& value) {
+  return *value;
+}
+
+static std::string AppendTo(std::string&& prefix, const char* suffix) {
+  prefix.append(suffix);
+  return prefix;
+}
+
+static void Increase(int& value) {  // NOLINT
+  ++value;
+}
+
+TEST_F(CallbackTest, TestMoveOnlyPreBoundArgument) {
+  std::unique_ptr<int> value(new int(40));
+  Callback<int(int)>* c = NewCallback(&TakeOwnership, std::move(value));
+  EXPECT_EQ(42, c->Run(2));
+
+  // A permanent callback keeps it and lends it out by reference.
+  Callback<int()>* p =
+      NewPermanentCallback(&PeekOwnership, std::unique_ptr<int>(new int(7)));
+  EXPECT_EQ(7, p->Run());
+  EXPECT_EQ(7, p->Run());
+  delete p;
+}
+
+TEST_F(CallbackTest, TestRvalueReferenceParameter) {
+  Callback<std::string(const char*)>* c =
+      NewCallback(&AppendTo, std::string("foo"));
+  EXPECT_EQ("foobar", c->Run("bar"));
+}
+
+class NamedBase {
+ public:
+  virtual ~NamedBase() {}
+  virtual std::string Name() const { return "Base"; }
+};
+
+class NamedDerived : public NamedBase {
+ public:
+  virtual std::string Name() const { return "Derived"; }
+};
+
+class AbstractShape {
+ public:
+  virtual ~AbstractShape() {}
+  virtual std::string Name() const = 0;
+};
+
+class Square : public AbstractShape {
+ public:
+  virtual std::string Name() const { return "Square"; }
+};
+
+static std::string NameOf(const NamedBase& object) {
+  return object.Name();
+}
+
+static std::string ShapeNameOf(const AbstractShape& shape) {
+  return shape.Name();
+}
+
+TEST_F(CallbackTest, TestDerivedArgumentIsNotSliced) {
+  // Stored as the argument's type, not the parameter's.
+  NamedDerived derived;
+  EXPECT_EQ("Derived", NewCallback(&NameOf, derived)->Run());
+  Callback<std::string()>* p = NewPermanentCallback(&NameOf, derived);
+  EXPECT_EQ("Derived", p->Run());
+  EXPECT_EQ("Derived", p->Run());
+  delete p;
+}
+
+TEST_F(CallbackTest, TestAbstractBaseReferenceParameter) {
+  EXPECT_EQ("Square", NewCallback(&ShapeNameOf, Square())->Run());
+  Callback<std::string()>* p = NewPermanentCallback(&ShapeNameOf, Square());
+  EXPECT_EQ("Square", p->Run());
+  delete p;
+}
+
+static std::string ConcatOf(const std::string& prefix, const char* suffix) {
+  return prefix + suffix;
+}
+
+TEST_F(CallbackTest, TestArgumentIsConvertedAtRun) {
+  // Stored as const char*, a std::string is made for each run.
+  Callback<std::string(const char*)>* c = NewCallback(&AppendTo, "foo");
+  EXPECT_EQ("foobar", c->Run("bar"));
+  Callback<std::string(const char*)>* p =
+      NewPermanentCallback(&ConcatOf, "foo");
+  EXPECT_EQ("foobar", p->Run("bar"));
+  EXPECT_EQ("foobaz", p->Run("baz"));
+  delete p;
+}
+
+TEST_F(CallbackTest, TestLvalueReferenceParameter) {
+  // The callback increases its own copy, as before.
+  int value = 0;
+  Closure* c = NewPermanentCallback(&Increase, value);
+  c->Run();
+  c->Run();
+  EXPECT_EQ(0, value);
+  delete c;
+  NewCallback(&Increase, value)->Run();
+  EXPECT_EQ(0, value);
+}
+
+class PayloadSink {
+ public:
+  PayloadSink() : copies_(-1) {}
+  void Take(CopyCounter counter) { copies_ = counter.copies; }
+  void TakeBoth(CopyCounter first, CopyCounter second) {
+    copies_ = first.copies + second.copies;
+  }
+  int copies() const { return copies_; }
+ private:
+  int copies_;
+};
+
+TEST_F(CallbackTest, TestPayloadIsMovedThrough) {
+  PayloadSink sink;
+  // Call-time payload passed by value is moved on to the target.
+  Callback<void(CopyCounter)>* c = NewCallback(&sink, &PayloadSink::Take);
+  c->Run(CopyCounter());
+  EXPECT_EQ(0, sink.copies());
+  // So is a pre-bound one on the final run of a self-deleting callback.
+  c = NewCallback(&sink, &PayloadSink::TakeBoth, CopyCounter());
+  c->Run(CopyCounter());
+  EXPECT_EQ(0, sink.copies());
+}
+
+// Move-only functor.
+class OwningAdder {
+ public:
+  explicit OwningAdder(int base) : base_(new int(base)) {}
+  int operator()(int a) { return *base_ + a; }
+ private:
+  std::unique_ptr<int> base_;
+};
+
+TEST_F(CallbackTest, TestLambdaCallback) {
+  int count = 0;
+  Closure* c = NewCallback([&count]() { ++count; });
+  EXPECT_FALSE(c->IsRepeatable());
+  Do(c);
+  EXPECT_EQ(1, count);
+
+  Do(NewCallback([](A1 a) {}));
+  Do(NewCallback([](A1 a, A2 b) {}));
+  Do(NewCallback([]() { return r1; }));
+  Do(NewCallback([](A1 a) { return r1; }));
+  Do(NewCallback([](A1 a, A2 b) { return r1; }));
+
+  std::string prefix("foo");
+  Callback<std::string(const char*)>* append =
+      NewCallback([prefix](const char* suffix) { return prefix + suffix; });
+  EXPECT_EQ("foobar", append->Run("bar"));
+}
+
+TEST_F(CallbackTest, TestPermanentLambdaCallback) {
+  int count = 0;
+  Callback<int()>* c = NewPermanentCallback([count]() mutable {
+    return ++count;
+  });
+  EXPECT_TRUE(c->IsRepeatable());
+  EXPECT_EQ(1, c->Run());
+  EXPECT_EQ(2, c->Run());
+  delete c;
+  EXPECT_EQ(0, count);
+}
+
+TEST_F(CallbackTest, TestMoveOnlyFunctorCallback) {
+  Callback<int(int)>* c = NewCallback(OwningAdder(40));
+  EXPECT_EQ(42, c->Run(2));
+}
@@ -0,0 +1,119 @@
+#ifndef COMMON_BASE_CANCELLABLE_CALLBACK_H_
+#define COMMON_BASE_CANCELLABLE_CALLBACK_H_
+
+#include <atomic>
+#include <utility>
+#include "common/base/callback.h"
+
+// CancellableCallback<void(Args...)> wraps a Callback so that a completion
+// path and a cancellation path (typically a timeout) can race for it: the
+// first of Run() and Cancel() wins, the other one is a no-op.  The outcome
+// and the lifetime of the wrapper are decided by one atomic state word,
+// which each side updates with a single fetch_or; nothing is locked or
+// allocated besides the wrapper itself.
+//
+//   CancellableCallback<void()>* done = NewCancellableCallback(
+//       NewCallback(this, &Runner::HandleActionDone));
+//   timer_id_ = timers->ScheduleAfter(timeout_us, done->cancel_closure());
+//   action->CallService(context, done);
+//   ...
+//   // once the action has completed
+//   if (timers->Cancel(timer_id_)) {
+//     done->Release();   // the timeout won't come any more
+//   }
+//
+// There are two sides, each of which must finish exactly once:
+//  - the completion side by calling Run();
+//  - the cancellation side by calling Cancel() (or running
+//    cancel_closure()), or Release() if it gives up without cancelling.
+// The wrapper deletes itself when both have finished.  The wrapped callback
+// is run by a winning Run(), or deleted by a winning Cancel() unless it is
+// repeatable.
+template <typename Signature>
+class CancellableCallback;
+
+template <typename... Args>
+class CancellableCallback<void(Args...)> : public Callback<void(Args...)> {
+ public:
+  explicit CancellableCallback(Callback<void(Args...)>* callback)
+      : callback_(callback), state_(0), cancel_closure_(this) {}
+
+  virtual bool IsRepeatable() const { return false; }
+
+  // Completion side.  Runs the wrapped callback unless Cancel() came first.
+  virtual void Run(Args... args) {
+    Callback<void(Args...)>* callback = callback_;
+    int state = state_.fetch_or(kClaimed | kRunnerDone,
+                                std::memory_order_acq_rel);
+    if ((state & kClaimed) == 0) {
+      callback->Run(std::forward<Args>(args)...);
+    }
+    if ((state & kCancellerDone) != 0) {
+      delete this;
+    }
+  }
+
+  // Cancellation side.  Returns true if the wrapped callback will never
+  // run, false if Run() came first.
+  bool Cancel() {
+    Callback<void(Args...)>* callback = callback_;
+    int state = state_.fetch_or(kClaimed | kCancellerDone,
+                                std::memory_order_acq_rel);
+    bool cancelled = (state & kClaimed) == 0;
+    if (cancelled && !callback->IsRepeatable()) {
+      delete callback;
+    }
+    if ((state & kRunnerDone) != 0) {
+      delete this;
+    }
+    return cancelled;
+  }
+
+  // Cancellation side, without cancelling.
+  void Release() {
+    int state = state_.fetch_or(kCancellerDone, std::memory_order_acq_rel);
+    if ((state & kRunnerDone) != 0) {
+      delete this;
+    }
+  }
+
+  // A Closure calling Cancel(), owned by this wrapper (it is repeatable,
+  // so whoever runs it doesn't delete it); handy as a timer callback.
+  Closure* cancel_closure() {
+    return &cancel_closure_;
+  }
+
+  // True once Run() or Cancel() has decided.  Only meaningful from the
+  // side which hasn't finished yet.
+  bool IsDecided() const {
+    return (state_.load(std::memory_order_acquire) & kClaimed) != 0;
+  }
+
+ private:
+  enum {
+    kClaimed = 1,
+    kRunnerDone = 2,
+    kCancellerDone = 4,
+  };
+
+  class CancelClosure : public Closure {
+   public:
+    explicit CancelClosure(CancellableCallback* owner) : owner_(owner) {}
+    virtual bool IsRepeatable() const { return true; }
+    virtual void Run() { owner_->Cancel(); }
+   private:
+    CancellableCallback* owner_;
+  };
+
+  Callback<void(Args...)>* callback_;
+  std::atomic<int> state_;
+  CancelClosure cancel_closure_;
+};
+
+template <typename... Args>
+CancellableCallback<void(Args...)>* NewCancellableCallback(
+    Callback<void(Args...)>* callback) {
+  return new CancellableCallback<void(Args...)>(callback);
+}
+
+#endif  // COMMON_BASE_CANCELLABLE_CALLBACK_H_
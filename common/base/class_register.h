@@ -6,7 +6,8 @@
 #define PP_DO_JOIN(X, Y) PP_DO_JOIN2(X, Y)
 #define PP_DO_JOIN2(X, Y) X##Y
 
-#include <map>
+#include <stddef.h>
+#include <functional>
 #include <vector>
 #include <string>
 
@@ -39,43 +40,142 @@
 // ClassRegistry manage (name -> creator) mapping.
 // One base class may have multiple registry instance, distinguished by the
 // register_name.
+//
+// CreateObject runs for every state of every request, so the mapping is an
+// open addressing hash table with linear probing, kept at most half full,
+// each entry holding the hash of its name: a lookup hashes the name once
+// and compares strings only on a full hash match.  Creators are added
+// during static initialization, before any lookup; lookups don't modify
+// the table and may run concurrently.
+//
+// Code creating the same class over and over can skip even that: look the
+// name up once with GetCreatorId(), at startup or on first use, and create
+// by the CreatorId it returns, which is a plain array index.
+//
+//   static const ClassRegistry<Mapper>::CreatorId kHelloMapper =
+//       CLASS_REGISTER_GET_CREATOR_ID(mapper_register, "HelloMapper");
+//   Mapper* mapper = CREATE_MAPPER(kHelloMapper);
 template <typename BaseClassName>
 class ClassRegistry {
  public:
   typedef BaseClassName* (*Creator)();
- 
+  // Stable for the life of the process; ids count up from 0 in
+  // registration order.
+  typedef int CreatorId;
+  static const CreatorId kInvalidCreatorId = -1;
+
  private:
-  typedef std::map<std::string, Creator> ClassMap;
+  struct Entry {
+    Entry() : hash(0), id(kInvalidCreatorId) {}
+    size_t hash;
+    std::string name;
+    // kInvalidCreatorId for an empty entry.
+    CreatorId id;
+  };
 
  public:
-  ClassRegistry() {}
+  ClassRegistry() : size_(0) {}
   ~ClassRegistry() {}
 
   void AddCreator(const std::string& entry_name, Creator creator) {
-    typename ClassMap::iterator it = creator_map_.find(entry_name);
-    if (it != creator_map_.end()) {
+    size_t hash = Hash(entry_name);
+    if (Find(entry_name, hash) != NULL) {
       fprintf(stderr,
               "ClassRegister: class %s already registered.",
               entry_name.c_str());
       abort();
     }
-    creator_map_.insert(make_pair(entry_name, creator));
+    if ((size_ + 1) * 2 > entries_.size()) {
+      Rehash(entries_.empty() ? 16 : entries_.size() * 2);
+    }
+    Insert(entry_name, hash, creators_.size());
+    creators_.push_back(creator);
     creator_names_.push_back(entry_name);
   }
 
   BaseClassName* CreateObject(const std::string& entry_name) const {
-    typename ClassMap::const_iterator it = creator_map_.find(entry_name);
-    if (it == creator_map_.end()) {
+    return CreateObject(GetCreatorId(entry_name));
+  }
+
+  // NULL for kInvalidCreatorId.
+  BaseClassName* CreateObject(CreatorId id) const {
+    if (id < 0 || id >= static_cast<CreatorId>(creators_.size())) {
       return NULL;
     }
-    return (it->second)();
+    return (creators_[id])();
   }
- 
+
+  // kInvalidCreatorId if entry_name is not registered.
+  CreatorId GetCreatorId(const std::string& entry_name) const {
+    const Entry* entry = Find(entry_name, Hash(entry_name));
+    return entry == NULL ? kInvalidCreatorId : entry->id;
+  }
+
+  // Empty for kInvalidCreatorId.
+  const std::string& GetCreatorName(CreatorId id) const {
+    static const std::string empty_name;
+    if (id < 0 || id >= static_cast<CreatorId>(creator_names_.size())) {
+      return empty_name;
+    }
+    return creator_names_[id];
+  }
+
  private:
+  static size_t Hash(const std::string& name) {
+    return std::hash<std::string>()(name);
+  }
+
+  const Entry* Find(const std::string& name, size_t hash) const {
+    if (entries_.empty()) {
+      return NULL;
+    }
+    size_t mask = entries_.size() - 1;
+    for (size_t i = hash & mask; ; i = (i + 1) & mask) {
+      const Entry& entry = entries_[i];
+      if (entry.id == kInvalidCreatorId) {
+        return NULL;
+      }
+      if (entry.hash == hash && entry.name == name) {
+        return &entry;
+      }
+    }
+  }
+
+  void Insert(const std::string& name, size_t hash, CreatorId id) {
+    size_t mask = entries_.size() - 1;
+    size_t i = hash & mask;
+    while (entries_[i].id != kInvalidCreatorId) {
+      i = (i + 1) & mask;
+    }
+    entries_[i].hash = hash;
+    entries_[i].name = name;
+    entries_[i].id = id;
+    ++size_;
+  }
+
+  // capacity is a power of 2.
+  void Rehash(size_t capacity) {
+    std::vector<Entry> entries(capacity);
+    entries_.swap(entries);
+    size_ = 0;
+    for (size_t i = 0; i < entries.size(); ++i) {
+      if (entries[i].id != kInvalidCreatorId) {
+        Insert(entries[i].name, entries[i].hash, entries[i].id);
+      }
+    }
+  }
+
+  // Indexed by CreatorId.
+  std::vector<Creator> creators_;
   std::vector<std::string> creator_names_;
-  ClassMap creator_map_;
+  std::vector<Entry> entries_;
+  size_t size_;
 };
 
+template <typename BaseClassName>
+const typename ClassRegistry<BaseClassName>::CreatorId
+    ClassRegistry<BaseClassName>::kInvalidCreatorId;
+
 // Get the registry singleton instance for a given register_name
 template <typename RegistryTag>
 ClassRegistry<typename RegistryTag::BaseClass>& GetRegistry() {
@@ -135,10 +235,14 @@ public:
             entry_name, \
             &ClassRegistry_NewObject<base_class, sub_class>)
 
-// Create object from registry by name.
+// Create object from registry by name, or by CreatorId.
 // Namespace prefix is required for register_name if it is defined in different
 // namespace
 #define CLASS_REGISTER_CREATE_OBJECT(register_name, entry_name_as_string) \
     GetRegistry<register_name##RegistryTag>().CreateObject(entry_name_as_string)
 
+// Get the CreatorId of a registered name, kInvalidCreatorId if there is none.
+#define CLASS_REGISTER_GET_CREATOR_ID(register_name, entry_name_as_string) \
+    GetRegistry<register_name##RegistryTag>().GetCreatorId(entry_name_as_string)
+
 #endif
@@ -0,0 +1,82 @@
+#include "common/base/class_register.h"
+
+#include <map>
+#include <string>
+#include <vector>
+#include "thirdparty/benchmark/benchmark.h"
+
+// Per-lookup cost of CreateObject() with kClassNum registered names, the
+// way RpcFlowControl creates a state on every transition, against the
+// std::map registry it replaced.  The creator returns a static object, so
+// only the lookup is measured.
+//
+//   class_register_benchmark --benchmark_format=json
+
+static const int kClassNum = 500;
+
+class BaseState {
+ public:
+  virtual ~BaseState() {}
+};
+
+static BaseState* StaticState() {
+  static BaseState state;
+  return &state;
+}
+
+class MapClassRegistry {
+ public:
+  typedef BaseState* (*Creator)();
+
+  void AddCreator(const std::string& entry_name, Creator creator) {
+    creator_map_.insert(make_pair(entry_name, creator));
+  }
+
+  BaseState* CreateObject(const std::string& entry_name) const {
+    std::map<std::string, Creator>::const_iterator it =
+        creator_map_.find(entry_name);
+    if (it == creator_map_.end()) {
+      return NULL;
+    }
+    return (it->second)();
+  }
+
+ private:
+  std::map<std::string, Creator> creator_map_;
+};
+
+// Names share a long prefix, like state names in one service usually do.
+static std::vector<std::string> ClassNames() {
+  std::vector<std::string> names;
+  for (int i = 0; i < kClassNum; ++i) {
+    names.push_back("FeedsRecallMergeState" + std::to_string(i));
+  }
+  return names;
+}
+
+template <typename Registry>
+static void BM_CreateObject(benchmark::State& state) {
+  std::vector<std::string> names = ClassNames();
+  Registry registry;
+  for (size_t i = 0; i < names.size(); ++i) {
+    registry.AddCreator(names[i], &StaticState);
+  }
+  // A fixed pseudo random visiting order, so the map isn't walked in order.
+  std::vector<std::string> lookups;
+  for (size_t i = 0; i < names.size(); ++i) {
+    lookups.push_back(names[i * 7919 % names.size()]);
+  }
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(registry.CreateObject(lookups[i]));
+    if (++i == lookups.size()) {
+      i = 0;
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_CreateObject, MapClassRegistry);
+BENCHMARK_TEMPLATE(BM_CreateObject, ClassRegistry<BaseState>);
+
+BENCHMARK_MAIN();
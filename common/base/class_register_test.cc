@@ -60,3 +60,59 @@ TEST(ClassRegisterTest, Test0) {
   EXPECT_EQ("SubClass2", sub_class2->call());
   EXPECT_EQ("SubClass3", sub_class3->call());
 }
+
+TEST(ClassRegisterTest, UnknownClass) {
+  EXPECT_TRUE(CREATE_CLASS("SubClass4") == NULL);
+  EXPECT_TRUE(CREATE_CLASS("") == NULL);
+}
+
+static BaseClass* NewSubClass1() {
+  return new SubClass1();
+}
+
+static BaseClass* NewSubClass2() {
+  return new SubClass2();
+}
+
+// enough entries to grow the table several times
+TEST(ClassRegisterTest, ManyClasses) {
+  ClassRegistry<BaseClass> registry;
+  EXPECT_TRUE(registry.CreateObject("Class0") == NULL);
+  const int kClassNum = 1000;
+  for (int i = 0; i < kClassNum; ++i) {
+    registry.AddCreator("Class" + std::to_string(i),
+                        i % 2 == 0 ? &NewSubClass1 : &NewSubClass2);
+  }
+  for (int i = 0; i < kClassNum; ++i) {
+    BaseClass* object = registry.CreateObject("Class" + std::to_string(i));
+    ASSERT_TRUE(object != NULL);
+    EXPECT_EQ(i % 2 == 0 ? "SubClass1" : "SubClass2", object->call());
+    delete object;
+  }
+  EXPECT_TRUE(registry.CreateObject("Class" + std::to_string(kClassNum)) ==
+              NULL);
+}
+
+TEST(ClassRegisterTest, CreatorId) {
+  typedef ClassRegistry<BaseClass>::CreatorId CreatorId;
+  CreatorId id2 = CLASS_REGISTER_GET_CREATOR_ID(test_register, "SubClass2");
+  CreatorId id3 = CLASS_REGISTER_GET_CREATOR_ID(test_register, "SubClass3");
+  ASSERT_NE(ClassRegistry<BaseClass>::kInvalidCreatorId, id2);
+  ASSERT_NE(ClassRegistry<BaseClass>::kInvalidCreatorId, id3);
+  EXPECT_NE(id2, id3);
+  EXPECT_EQ(ClassRegistry<BaseClass>::kInvalidCreatorId,
+            CLASS_REGISTER_GET_CREATOR_ID(test_register, "SubClass4"));
+
+  BaseClass* sub_class2 = CREATE_CLASS(id2);
+  BaseClass* sub_class3 = CREATE_CLASS(id3);
+  EXPECT_EQ("SubClass2", sub_class2->call());
+  EXPECT_EQ("SubClass3", sub_class3->call());
+  delete sub_class2;
+  delete sub_class3;
+  EXPECT_TRUE(CREATE_CLASS(ClassRegistry<BaseClass>::kInvalidCreatorId) ==
+              NULL);
+  EXPECT_EQ("SubClass2",
+            GetRegistry<test_registerRegistryTag>().GetCreatorName(id2));
+  EXPECT_EQ("", GetRegistry<test_registerRegistryTag>().GetCreatorName(
+      ClassRegistry<BaseClass>::kInvalidCreatorId));
+}
@@ -0,0 +1,105 @@
+#ifndef COMMON_BASE_CLOSURE_COROUTINE_H_
+#define COMMON_BASE_CLOSURE_COROUTINE_H_
+
+// C++20 coroutine support for APIs which report completion by running a
+// Closure* done.  Empty unless the compiler implements coroutines.
+//
+// A coroutine returning ClosureTask can co_await AwaitClosure(start), where
+// start is called with the Closure to pass as done; the coroutine resumes
+// when done is run, on the thread running it.  Several hops which used to
+// need a runner object and a callback method each read top to bottom:
+//
+//   ClosureTask Lookup(RpcContext* context, Closure* done) {
+//     co_await AwaitClosure([&](Closure* resume) {
+//       user_action_->CallService(context, resume);
+//     });
+//     user_action_->ProcessResponse(context);
+//     co_await AwaitClosure([&](Closure* resume) {
+//       ads_action_->CallService(context, resume);
+//     });
+//     ads_action_->ProcessResponse(context);
+//     done->Run();
+//   }
+//
+// The done closure AwaitClosure() hands out lives in the coroutine frame, so
+// awaiting allocates nothing; it must be run exactly once.  The frame itself
+// comes from CallbackPool.  A ClosureTask starts running when called and
+// frees its frame when it returns; it is not awaitable.
+
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L
+
+#include <stddef.h>
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <utility>
+#include "common/base/callback.h"
+#include "common/base/callback_pool.h"
+
+class ClosureTask {
+ public:
+  class promise_type {
+   public:
+    static void* operator new(size_t size) {
+      return CallbackPool::Allocate(size);
+    }
+    static void operator delete(void* frame, size_t size) {
+      CallbackPool::Deallocate(frame, size);
+    }
+
+    ClosureTask get_return_object() { return ClosureTask(); }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() {}
+    void unhandled_exception() { std::terminate(); }
+  };
+};
+
+template <typename Start>
+class ClosureAwaitable {
+ public:
+  explicit ClosureAwaitable(Start&& start)
+      : start_(std::forward<Start>(start)), resume_(this) {}
+
+  bool await_ready() const { return false; }
+
+  // Whichever of this and done->Run() comes second resumes the coroutine,
+  // so done may be run inside start, or on another thread meanwhile.
+  bool await_suspend(std::coroutine_handle<> handle) {
+    handle_ = handle;
+    start_(&resume_);
+    return !arrived_.exchange(true, std::memory_order_acq_rel);
+  }
+
+  void await_resume() const {}
+
+ private:
+  class Resumer : public Closure {
+   public:
+    explicit Resumer(ClosureAwaitable* awaitable) : awaitable_(awaitable) {}
+    virtual bool IsRepeatable() const { return true; }
+    virtual void Run() {
+      if (awaitable_->arrived_.exchange(true, std::memory_order_acq_rel)) {
+        awaitable_->handle_.resume();
+      }
+    }
+
+   private:
+    ClosureAwaitable* awaitable_;
+  };
+
+  Start start_;
+  Resumer resume_;
+  std::coroutine_handle<> handle_;
+  std::atomic<bool> arrived_{false};
+};
+
+// start is called with the Closure to pass on as done.
+template <typename Start>
+ClosureAwaitable<Start> AwaitClosure(Start&& start) {
+  return ClosureAwaitable<Start>(std::forward<Start>(start));
+}
+
+#endif  // __cpp_impl_coroutine
+
+#endif  // COMMON_BASE_CLOSURE_COROUTINE_H_
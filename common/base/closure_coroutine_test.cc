@@ -0,0 +1,108 @@
+#include "common/base/closure_coroutine.h"
+
+#include "thirdparty/gtest/gtest.h"
+
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// Completes its calls when told to, like a downstream service would.
+class FakeService {
+ public:
+  void Call(int request, int* response, Closure* done) {
+    pending_.push_back(Pending{ request, response, done });
+  }
+
+  // Answers the oldest call; returns false if there is none.
+  bool Respond() {
+    if (pending_.empty()) {
+      return false;
+    }
+    Pending call = pending_.front();
+    pending_.erase(pending_.begin());
+    *call.response = call.request + 1;
+    call.done->Run();
+    return true;
+  }
+
+ private:
+  struct Pending {
+    int request;
+    int* response;
+    Closure* done;
+  };
+  std::vector<Pending> pending_;
+};
+
+static ClosureTask ThreeHops(FakeService* service, int* result,
+                             Closure* done) {
+  int value = 0;
+  for (int hop = 0; hop < 3; ++hop) {
+    co_await AwaitClosure([&](Closure* resume) {
+      service->Call(value, &value, resume);
+    });
+  }
+  *result = value;
+  done->Run();
+}
+
+static void SetFlag(bool* flag) {
+  *flag = true;
+}
+
+TEST(ClosureCoroutineTest, ResumesWhenDoneRuns) {
+  FakeService service;
+  int result = 0;
+  bool finished = false;
+  ThreeHops(&service, &result, NewCallback(&SetFlag, &finished));
+  EXPECT_FALSE(finished);
+  EXPECT_TRUE(service.Respond());
+  EXPECT_TRUE(service.Respond());
+  EXPECT_FALSE(finished);
+  EXPECT_TRUE(service.Respond());
+  EXPECT_TRUE(finished);
+  EXPECT_EQ(3, result);
+  EXPECT_FALSE(service.Respond());
+}
+
+static ClosureTask CompleteInline(int* hops, Closure* done) {
+  for (int i = 0; i < 1000; ++i) {
+    co_await AwaitClosure([](Closure* resume) { resume->Run(); });
+    ++*hops;
+  }
+  done->Run();
+}
+
+// done run inside the call doesn't suspend, nor grow the stack.
+TEST(ClosureCoroutineTest, DoneRunInline) {
+  int hops = 0;
+  bool finished = false;
+  CompleteInline(&hops, NewCallback(&SetFlag, &finished));
+  EXPECT_TRUE(finished);
+  EXPECT_EQ(1000, hops);
+}
+
+static ClosureTask CompleteOnThreads(std::atomic<int>* hops,
+                                     std::atomic<bool>* finished) {
+  for (int i = 0; i < 100; ++i) {
+    co_await AwaitClosure([](Closure* resume) {
+      std::thread(&Closure::Run, resume).detach();
+    });
+    ++*hops;
+  }
+  *finished = true;
+}
+
+TEST(ClosureCoroutineTest, DoneRunOnOtherThreads) {
+  std::atomic<int> hops(0);
+  std::atomic<bool> finished(false);
+  CompleteOnThreads(&hops, &finished);
+  while (!finished.load()) {
+    std::this_thread::yield();
+  }
+  EXPECT_EQ(100, hops.load());
+}
+
+#endif  // __cpp_impl_coroutine
@@ -0,0 +1,132 @@
+#ifndef COMMON_BASE_CLOSURE_QUEUE_H_
+#define COMMON_BASE_CLOSURE_QUEUE_H_
+
+#include <stddef.h>
+#include <atomic>
+#include "common/base/callback.h"
+
+// ClosureQueue is a lock-free multi-producer/single-consumer FIFO of
+// Closures.  It is intrusive: closures are linked through their own
+// Closure::next_closure field, so Push() never allocates.  A closure may
+// be in at most one ClosureQueue at a time, and must not be touched by
+// anybody else between Push() and the Pop() returning it.
+//
+// Typical use is handing completion callbacks from I/O threads to a single
+// worker:
+//
+//   // any thread
+//   queue.Push(NewCallback(this, &Worker::HandleResponse, response));
+//
+//   // worker thread
+//   queue.RunAll();
+//
+// This is Dmitry Vyukov's intrusive MPSC queue: Push() is one atomic
+// exchange plus one store.  Pop() is wait-free, but may return NULL for a
+// short time while a producer is between those two steps, even though the
+// queue is not empty; consumers should treat NULL as "try again later".
+class ClosureQueue {
+ public:
+  ClosureQueue() : head_(&stub_), tail_(&stub_) {
+    stub_.next_closure = NULL;
+  }
+
+  // Any thread.
+  void Push(Closure* closure) {
+    __atomic_store_n(&closure->next_closure, static_cast<Closure*>(NULL),
+                     __ATOMIC_RELAXED);
+    Closure* prev = head_.exchange(closure, std::memory_order_acq_rel);
+    __atomic_store_n(&prev->next_closure, closure, __ATOMIC_RELEASE);
+  }
+
+  // Any thread.  Pushes the closures linked from first through
+  // Closure::next_closure up to last, in that order, with one exchange.
+  void PushChain(Closure* first, Closure* last) {
+    __atomic_store_n(&last->next_closure, static_cast<Closure*>(NULL),
+                     __ATOMIC_RELAXED);
+    Closure* prev = head_.exchange(last, std::memory_order_acq_rel);
+    __atomic_store_n(&prev->next_closure, first, __ATOMIC_RELEASE);
+  }
+
+  // Consumer thread only.  Returns NULL if no closure is available.
+  Closure* Pop() {
+    Closure* tail = tail_;
+    Closure* next = __atomic_load_n(&tail->next_closure, __ATOMIC_ACQUIRE);
+    if (tail == &stub_) {
+      if (next == NULL) {
+        return NULL;
+      }
+      tail_ = next;
+      tail = next;
+      next = __atomic_load_n(&next->next_closure, __ATOMIC_ACQUIRE);
+    }
+    if (next != NULL) {
+      tail_ = next;
+      return tail;
+    }
+    if (tail != head_.load(std::memory_order_acquire)) {
+      // A producer has swapped head_ but not linked its closure yet.
+      return NULL;
+    }
+    Push(&stub_);
+    next = __atomic_load_n(&tail->next_closure, __ATOMIC_ACQUIRE);
+    if (next != NULL) {
+      tail_ = next;
+      return tail;
+    }
+    return NULL;
+  }
+
+  // Consumer thread only.  Pops up to max_count closures into closures[],
+  // returns how many were popped.
+  size_t PopBatch(Closure** closures, size_t max_count) {
+    size_t count = 0;
+    while (count < max_count) {
+      Closure* closure = Pop();
+      if (closure == NULL) {
+        break;
+      }
+      closures[count++] = closure;
+    }
+    return count;
+  }
+
+  // Consumer thread only.  Pops and runs up to max_count closures, returns
+  // how many were run.  Closures pushed by the ones being run are run too,
+  // within the limit.
+  size_t RunAll(size_t max_count = static_cast<size_t>(-1)) {
+    size_t count = 0;
+    while (count < max_count) {
+      Closure* closure = Pop();
+      if (closure == NULL) {
+        break;
+      }
+      closure->Run();
+      ++count;
+    }
+    return count;
+  }
+
+  // Consumer thread only.  May return false for a short time after the
+  // last Pop() while a producer is still pushing.
+  bool Empty() const {
+    return tail_ == &stub_ &&
+        __atomic_load_n(&stub_.next_closure, __ATOMIC_ACQUIRE) == NULL;
+  }
+
+ private:
+  class Stub : public Closure {
+   public:
+    virtual bool IsRepeatable() const { return true; }
+    virtual void Run() {}
+  };
+
+  // head_ is written by producers, tail_ only by the consumer; keep them on
+  // different cache lines.
+  alignas(64) std::atomic<Closure*> head_;
+  alignas(64) Closure* tail_;
+  Stub stub_;
+
+  DISALLOW_COPY_AND_ASSIGN(ClosureQueue);
+};
+
+#endif  // COMMON_BASE_CLOSURE_QUEUE_H_
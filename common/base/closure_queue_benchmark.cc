@@ -0,0 +1,121 @@
+#include "common/base/closure_queue.h"
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "thirdparty/benchmark/benchmark.h"
+
+// Throughput of one consumer draining closures pushed concurrently by N
+// producer threads, against a mutex protected std::deque.  Each iteration
+// is one round: every producer pushes kClosuresPerProducer closures and the
+// consumer runs all of them.
+//
+//   closure_queue_benchmark --benchmark_format=json
+
+static const int kClosuresPerProducer = 1024;
+
+class MutexClosureQueue {
+ public:
+  void Push(Closure* closure) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closures_.push_back(closure);
+  }
+
+  size_t RunAll(size_t max_count) {
+    size_t count = 0;
+    while (count < max_count) {
+      Closure* closure;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (closures_.empty()) {
+          break;
+        }
+        closure = closures_.front();
+        closures_.pop_front();
+      }
+      closure->Run();
+      ++count;
+    }
+    return count;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::deque<Closure*> closures_;
+};
+
+static void Inc(int* count) {
+  ++*count;
+}
+
+template <typename Queue>
+static void Produce(Queue* queue, const std::vector<Closure*>* closures,
+                    const std::atomic<int>* round) {
+  int last = 0;
+  for (;;) {
+    int current;
+    while ((current = round->load(std::memory_order_acquire)) == last) {
+      std::this_thread::yield();
+    }
+    if (current < 0) {
+      return;
+    }
+    for (size_t i = 0; i < closures->size(); ++i) {
+      queue->Push((*closures)[i]);
+    }
+    last = current;
+  }
+}
+
+template <typename Queue>
+static void BM_Contention(benchmark::State& state) {
+  const int producer_num = static_cast<int>(state.range(0));
+  const size_t total = static_cast<size_t>(producer_num) * kClosuresPerProducer;
+  Queue queue;
+  int count = 0;
+  std::atomic<int> round(0);
+  // Permanent closures, so a round allocates nothing; every closure is out
+  // of the queue again before the next round pushes it.
+  std::vector<std::vector<Closure*> > closures(producer_num);
+  std::vector<std::thread> producers;
+  for (int p = 0; p < producer_num; ++p) {
+    for (int i = 0; i < kClosuresPerProducer; ++i) {
+      closures[p].push_back(NewPermanentCallback(&Inc, &count));
+    }
+    producers.push_back(
+        std::thread(&Produce<Queue>, &queue, &closures[p], &round));
+  }
+
+  for (auto _ : state) {
+    round.fetch_add(1, std::memory_order_release);
+    size_t run = 0;
+    while (run < total) {
+      size_t n = queue.RunAll(total - run);
+      if (n == 0) {
+        std::this_thread::yield();
+      }
+      run += n;
+    }
+  }
+
+  round.store(-1, std::memory_order_release);
+  for (size_t p = 0; p < producers.size(); ++p) {
+    producers[p].join();
+  }
+  for (int p = 0; p < producer_num; ++p) {
+    for (size_t i = 0; i < closures[p].size(); ++i) {
+      delete closures[p][i];
+    }
+  }
+  benchmark::DoNotOptimize(count);
+  state.SetItemsProcessed(state.iterations() * total);
+}
+
+BENCHMARK_TEMPLATE(BM_Contention, ClosureQueue)
+    ->Arg(1)->Arg(8)->Arg(32)->Arg(64)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Contention, MutexClosureQueue)
+    ->Arg(1)->Arg(8)->Arg(32)->Arg(64)->UseRealTime();
+
+BENCHMARK_MAIN();
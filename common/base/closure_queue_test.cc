@@ -0,0 +1,130 @@
+#include "common/base/closure_queue.h"
+
+#include <vector>
+#include "thirdparty/gtest/gtest.h"
+
+static void Append(std::vector<int>* order, int value) {
+  order->push_back(value);
+}
+
+TEST(ClosureQueueTest, Fifo) {
+  ClosureQueue queue;
+  std::vector<int> order;
+  EXPECT_TRUE(queue.Empty());
+  EXPECT_TRUE(queue.Pop() == NULL);
+  for (int i = 0; i < 5; ++i) {
+    queue.Push(NewCallback(&Append, &order, i));
+  }
+  EXPECT_FALSE(queue.Empty());
+  EXPECT_EQ(5u, queue.RunAll());
+  ASSERT_EQ(5u, order.size());
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_EQ(i, order[i]);
+  }
+  EXPECT_TRUE(queue.Empty());
+  EXPECT_TRUE(queue.Pop() == NULL);
+}
+
+TEST(ClosureQueueTest, PushAfterDrain) {
+  ClosureQueue queue;
+  std::vector<int> order;
+  for (int round = 0; round < 3; ++round) {
+    queue.Push(NewCallback(&Append, &order, round));
+    Closure* closure = queue.Pop();
+    ASSERT_TRUE(closure != NULL);
+    closure->Run();
+    EXPECT_TRUE(queue.Pop() == NULL);
+  }
+  EXPECT_EQ(3u, order.size());
+}
+
+TEST(ClosureQueueTest, PushChain) {
+  ClosureQueue queue;
+  std::vector<int> order;
+  queue.Push(NewCallback(&Append, &order, 0));
+  Closure* chain[3];
+  for (int i = 0; i < 3; ++i) {
+    chain[i] = NewCallback(&Append, &order, i + 1);
+  }
+  chain[0]->next_closure = chain[1];
+  chain[1]->next_closure = chain[2];
+  queue.PushChain(chain[0], chain[2]);
+  queue.Push(NewCallback(&Append, &order, 4));
+  EXPECT_EQ(5u, queue.RunAll());
+  ASSERT_EQ(5u, order.size());
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_EQ(i, order[i]);
+  }
+}
+
+TEST(ClosureQueueTest, PopBatch) {
+  ClosureQueue queue;
+  std::vector<int> order;
+  for (int i = 0; i < 10; ++i) {
+    queue.Push(NewCallback(&Append, &order, i));
+  }
+  Closure* batch[4];
+  size_t total = 0;
+  size_t count;
+  while ((count = queue.PopBatch(batch, 4)) != 0) {
+    EXPECT_LE(count, 4u);
+    for (size_t i = 0; i < count; ++i) {
+      batch[i]->Run();
+    }
+    total += count;
+  }
+  EXPECT_EQ(10u, total);
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(i, order[i]);
+  }
+}
+
+TEST(ClosureQueueTest, PermanentClosureCanBeRequeued) {
+  ClosureQueue queue;
+  std::vector<int> order;
+  Closure* closure = NewPermanentCallback(&Append, &order, 7);
+  for (int i = 0; i < 3; ++i) {
+    queue.Push(closure);
+    EXPECT_EQ(1u, queue.RunAll());
+  }
+  EXPECT_EQ(3u, order.size());
+  delete closure;
+}
+
+static void PushAll(ClosureQueue* queue, std::vector<int>* order,
+                    int producer, int count) {
+  for (int i = 0; i < count; ++i) {
+    queue->Push(NewCallback(&Append, order, producer * count + i));
+  }
+}
+
+// Every closure is run exactly once, and closures from one producer run in
+// the order that producer pushed them.
+TEST(ClosureQueueTest, MultipleProducers) {
+  const int kThreadNum = 8;
+  const int kClosureNum = 20000;
+  ClosureQueue queue;
+  std::vector<int> order;
+  std::vector<shared_ptr<Thread> > threads(kThreadNum);
+  for (int t = 0; t < kThreadNum; ++t) {
+    threads[t].reset(
+        new Thread(NewCallback(&PushAll, &queue, &order, t, kClosureNum)));
+    threads[t]->Start();
+  }
+  size_t run = 0;
+  while (run < static_cast<size_t>(kThreadNum * kClosureNum)) {
+    run += queue.RunAll(64);
+  }
+  for (int t = 0; t < kThreadNum; ++t) {
+    threads[t]->Join();
+  }
+  EXPECT_TRUE(queue.Pop() == NULL);
+
+  ASSERT_EQ(static_cast<size_t>(kThreadNum * kClosureNum), order.size());
+  std::vector<int> last(kThreadNum, -1);
+  for (size_t i = 0; i < order.size(); ++i) {
+    int producer = order[i] / kClosureNum;
+    EXPECT_LT(last[producer], order[i]);
+    last[producer] = order[i];
+  }
+}
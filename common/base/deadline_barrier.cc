@@ -0,0 +1,80 @@
+#include "common/base/deadline_barrier.h"
+
+#include "thirdparty/glog/logging.h"
+
+DeadlineBarrier::DeadlineBarrier(int n, int64_t deadline_us,
+                                 TimerWheel* timer_wheel, Done* done)
+    : n_(n), deadline_us_(deadline_us), timer_wheel_(timer_wheel),
+      timer_id_(0), done_(done), participants_(new Participant[n]),
+      timeout_(this), left_(n + 1), refs_(n + 2) {
+  CHECK_GE(n, 0);
+  for (int i = 0; i < n; ++i) {
+    participants_[i].barrier = this;
+    participants_[i].index = i;
+  }
+}
+
+bool DeadlineBarrier::Claim(int i) {
+  int state = kPending;
+  return participants_[i].state.compare_exchange_strong(
+      state, kClaimed, std::memory_order_acq_rel);
+}
+
+void DeadlineBarrier::Start() {
+  if (timer_wheel_ != NULL) {
+    // Set before the count below lets the barrier fire, which reads it.
+    timer_id_ = timer_wheel_->Schedule(deadline_us_, &timeout_);
+  } else {
+    Unref();
+  }
+  CountDown();
+}
+
+void DeadlineBarrier::Arrive(int i) {
+  int state = kPending;
+  if (participants_[i].state.compare_exchange_strong(
+          state, kArrived, std::memory_order_acq_rel) ||
+      state == kClaimed) {
+    CountDown();
+  }
+  // Otherwise it was late, and counted down at the deadline.
+  Unref();
+}
+
+void DeadlineBarrier::HandleTimeout() {
+  for (int i = 0; i < n_; ++i) {
+    int state = kPending;
+    if (participants_[i].state.compare_exchange_strong(
+            state, kLate, std::memory_order_acq_rel)) {
+      CountDown();
+    }
+  }
+  Unref();
+}
+
+void DeadlineBarrier::CountDown() {
+  if (left_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    Fire();
+  }
+}
+
+void DeadlineBarrier::Fire() {
+  // Fails if the timer is what got us here; it unrefs itself then.
+  if (timer_id_ != 0 && timer_wheel_->Cancel(timer_id_)) {
+    Unref();
+  }
+  std::vector<int> late;
+  for (int i = 0; i < n_; ++i) {
+    if (participants_[i].state.load(std::memory_order_acquire) == kLate) {
+      late.push_back(i);
+    }
+  }
+  done_->Run(late);
+  Unref();
+}
+
+void DeadlineBarrier::Unref() {
+  if (refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    delete this;
+  }
+}
@@ -0,0 +1,104 @@
+#ifndef COMMON_BASE_DEADLINE_BARRIER_H_
+#define COMMON_BASE_DEADLINE_BARRIER_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include "common/base/callback.h"
+#include "common/base/timer_wheel.h"
+
+// DeadlineBarrier runs done once all of its n participants have arrived,
+// or once deadline_us (MonotonicClock::MicroSeconds()) has passed,
+// whichever comes first.  Participants which hadn't arrived by then are
+// late: done gets their indexes, and their arrival later on is absorbed.
+//
+//   DeadlineBarrier* barrier = new DeadlineBarrier(
+//       n, MonotonicClock::MicroSeconds() + 50 * 1000, &timers,
+//       NewCallback(this, &Fanout::HandleReplies));  // (const vector<int>&)
+//   for (int i = 0; i < n; ++i) {
+//     stubs[i]->Search(..., barrier->participant(i));
+//   }
+//   barrier->Start();
+//
+// done doesn't run before Start(), which arms the deadline timer, so all
+// participants can be handed out first.  Each participant(i) must be run
+// exactly once, early or late.  A participant with work to do before it
+// arrives which must not overlap done (say, writing into a result done
+// reads) calls Claim(i) first: if that returns true, i is no longer late at
+// the deadline and done waits for its Run(); if it returns false, i is
+// already late and the work should be skipped.
+//
+// The barrier deletes itself once done has run, every participant has
+// run, and the timer has fired or been cancelled.  Without a timer_wheel
+// there is no deadline.
+class DeadlineBarrier {
+ public:
+  typedef Callback<void(const std::vector<int>&)> Done;
+
+  DeadlineBarrier(int n, int64_t deadline_us, TimerWheel* timer_wheel,
+                  Done* done);
+
+  // A repeatable Closure owned by the barrier.
+  Closure* participant(int i) {
+    return &participants_[i];
+  }
+
+  // Any thread, before participant(i) runs.
+  bool Claim(int i);
+
+  // Once.
+  void Start();
+
+ private:
+  enum ParticipantState {
+    kPending,
+    kClaimed,
+    kArrived,
+    kLate,
+  };
+
+  class Participant : public Closure {
+   public:
+    Participant() : barrier(NULL), index(0), state(kPending) {}
+    virtual bool IsRepeatable() const { return true; }
+    virtual void Run() { barrier->Arrive(index); }
+
+    DeadlineBarrier* barrier;
+    int index;
+    std::atomic<int> state;
+  };
+
+  class Timeout : public Closure {
+   public:
+    explicit Timeout(DeadlineBarrier* barrier) : barrier_(barrier) {}
+    virtual bool IsRepeatable() const { return true; }
+    virtual void Run() { barrier_->HandleTimeout(); }
+   private:
+    DeadlineBarrier* barrier_;
+  };
+
+  ~DeadlineBarrier() {}
+
+  void Arrive(int i);
+  void HandleTimeout();
+  void CountDown();
+  void Fire();
+  void Unref();
+
+  const int n_;
+  const int64_t deadline_us_;
+  TimerWheel* timer_wheel_;
+  TimerWheel::TimerId timer_id_;
+  Done* done_;
+  std::unique_ptr<Participant[]> participants_;
+  Timeout timeout_;
+  // Participants not arrived or late yet, plus one until Start().
+  std::atomic<int> left_;
+  // One per participant not run yet, one for the timer, one for done.
+  std::atomic<int> refs_;
+
+  DISALLOW_COPY_AND_ASSIGN(DeadlineBarrier);
+};
+
+#endif  // COMMON_BASE_DEADLINE_BARRIER_H_
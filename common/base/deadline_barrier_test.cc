@@ -0,0 +1,170 @@
+#include "common/base/deadline_barrier.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "common/base/clock.h"
+#include "thirdparty/gtest/gtest.h"
+
+static void RecordLate(std::vector<int>* late, int* count,
+                       const std::vector<int>& late_participants) {
+  *late = late_participants;
+  ++*count;
+}
+
+TEST(DeadlineBarrierTest, AllArriveBeforeDeadline) {
+  TimerWheel timers(1000);
+  int64_t now = MonotonicClock::MicroSeconds();
+  std::vector<int> late;
+  int count = 0;
+  DeadlineBarrier* barrier = new DeadlineBarrier(
+      3, now + 5000, &timers, NewCallback(&RecordLate, &late, &count));
+  barrier->participant(2)->Run();
+  barrier->participant(0)->Run();
+  barrier->Start();
+  EXPECT_EQ(1u, timers.size());
+  EXPECT_EQ(0, count);
+  barrier->participant(1)->Run();
+  EXPECT_EQ(1, count);
+  EXPECT_TRUE(late.empty());
+  // The deadline timer was cancelled.
+  EXPECT_EQ(0u, timers.size());
+  EXPECT_EQ(0u, timers.Advance(now + 10000));
+}
+
+TEST(DeadlineBarrierTest, NotBeforeStart) {
+  TimerWheel timers(1000);
+  int64_t now = MonotonicClock::MicroSeconds();
+  std::vector<int> late;
+  int count = 0;
+  DeadlineBarrier* barrier = new DeadlineBarrier(
+      2, now + 5000, &timers, NewCallback(&RecordLate, &late, &count));
+  barrier->participant(0)->Run();
+  barrier->participant(1)->Run();
+  EXPECT_EQ(0, count);
+  barrier->Start();
+  EXPECT_EQ(1, count);
+  EXPECT_TRUE(late.empty());
+}
+
+TEST(DeadlineBarrierTest, NoParticipants) {
+  TimerWheel timers(1000);
+  std::vector<int> late;
+  int count = 0;
+  DeadlineBarrier* barrier = new DeadlineBarrier(
+      0, MonotonicClock::MicroSeconds() + 5000, &timers,
+      NewCallback(&RecordLate, &late, &count));
+  barrier->Start();
+  EXPECT_EQ(1, count);
+  EXPECT_EQ(0u, timers.size());
+}
+
+TEST(DeadlineBarrierTest, FiresAtDeadline) {
+  TimerWheel timers(1000);
+  int64_t now = MonotonicClock::MicroSeconds();
+  std::vector<int> late;
+  int count = 0;
+  DeadlineBarrier* barrier = new DeadlineBarrier(
+      4, now + 5000, &timers, NewCallback(&RecordLate, &late, &count));
+  barrier->Start();
+  barrier->participant(1)->Run();
+  barrier->participant(2)->Run();
+  EXPECT_EQ(0u, timers.Advance(now + 3999));
+  EXPECT_EQ(0, count);
+  EXPECT_EQ(1u, timers.Advance(now + 6000));
+  EXPECT_EQ(1, count);
+  ASSERT_EQ(2u, late.size());
+  EXPECT_EQ(0, late[0]);
+  EXPECT_EQ(3, late[1]);
+
+  // Late participants are absorbed; the last one deletes the barrier.
+  EXPECT_FALSE(barrier->Claim(3));
+  barrier->participant(3)->Run();
+  barrier->participant(0)->Run();
+  EXPECT_EQ(1, count);
+}
+
+TEST(DeadlineBarrierTest, ClaimedIsNotLate) {
+  TimerWheel timers(1000);
+  int64_t now = MonotonicClock::MicroSeconds();
+  std::vector<int> late;
+  int count = 0;
+  DeadlineBarrier* barrier = new DeadlineBarrier(
+      2, now + 5000, &timers, NewCallback(&RecordLate, &late, &count));
+  barrier->Start();
+  EXPECT_TRUE(barrier->Claim(0));
+  timers.Advance(now + 6000);
+  // Waits for the claimed participant, which is past the deadline.
+  EXPECT_EQ(0, count);
+  barrier->participant(0)->Run();
+  EXPECT_EQ(1, count);
+  ASSERT_EQ(1u, late.size());
+  EXPECT_EQ(1, late[0]);
+  barrier->participant(1)->Run();
+}
+
+TEST(DeadlineBarrierTest, WithoutTimerWheel) {
+  std::vector<int> late;
+  int count = 0;
+  DeadlineBarrier* barrier = new DeadlineBarrier(
+      2, 0, NULL, NewCallback(&RecordLate, &late, &count));
+  barrier->Start();
+  barrier->participant(0)->Run();
+  EXPECT_EQ(0, count);
+  EXPECT_TRUE(barrier->Claim(1));
+  barrier->participant(1)->Run();
+  EXPECT_EQ(1, count);
+  EXPECT_TRUE(late.empty());
+}
+
+static void CountLate(std::atomic<int>* fired, std::atomic<int>* late,
+                      const std::vector<int>& late_participants) {
+  late->fetch_add(late_participants.size());
+  fired->fetch_add(1);
+}
+
+static void ClaimAndArrive(DeadlineBarrier* barrier, int begin, int end,
+                           std::atomic<int>* claimed) {
+  for (int i = begin; i < end; ++i) {
+    if (barrier->Claim(i)) {
+      claimed->fetch_add(1);
+    }
+    barrier->participant(i)->Run();
+  }
+}
+
+// Arrivals race the deadline on a driven wheel; every participant is either
+// claimed in time or reported late, and done runs once.
+TEST(DeadlineBarrierTest, ArrivalsRaceDeadline) {
+  const int kRounds = 200;
+  const int kThreadNum = 4;
+  const int kPerThread = 64;
+  TimerWheel timers(100);
+  timers.Start();
+  for (int round = 0; round < kRounds; ++round) {
+    std::atomic<int> fired(0);
+    std::atomic<int> late(0);
+    std::atomic<int> claimed(0);
+    DeadlineBarrier* barrier = new DeadlineBarrier(
+        kThreadNum * kPerThread,
+        MonotonicClock::MicroSeconds() + round % 5 * 100, &timers,
+        NewCallback(&CountLate, &fired, &late));
+    barrier->Start();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < kThreadNum; ++i) {
+      threads.push_back(std::thread(&ClaimAndArrive, barrier,
+                                    i * kPerThread, (i + 1) * kPerThread,
+                                    &claimed));
+    }
+    for (size_t i = 0; i < threads.size(); ++i) {
+      threads[i].join();
+    }
+    // The deadline may still be about to fire.
+    while (fired.load() == 0) {
+      std::this_thread::yield();
+    }
+    EXPECT_EQ(1, fired.load());
+    EXPECT_EQ(kThreadNum * kPerThread, claimed.load() + late.load());
+  }
+  timers.Stop();
+}
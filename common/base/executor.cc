@@ -0,0 +1,53 @@
+#include "common/base/executor.h"
+
+__thread ExecutorBatch* ExecutorBatch::current_ = NULL;
+
+void Executor::AddTasks(Closure* head) {
+  while (head != NULL) {
+    // Read before AddTask(), after which the task may run at once.
+    Closure* next = head->next_closure;
+    head->next_closure = NULL;
+    AddTask(head);
+    head = next;
+  }
+}
+
+ExecutorBatch::ExecutorBatch() : outer_(current_) {
+  current_ = this;
+}
+
+ExecutorBatch::~ExecutorBatch() {
+  Flush();
+  current_ = outer_;
+}
+
+void ExecutorBatch::Flush() {
+  // Running a task (on an InlineExecutor, say) may post more tasks into
+  // this batch.
+  while (!pending_.empty()) {
+    std::vector<Pending> pending;
+    pending.swap(pending_);
+    for (size_t i = 0; i < pending.size(); ++i) {
+      pending[i].executor->AddTasks(pending[i].head);
+    }
+  }
+}
+
+void ExecutorBatch::Post(Executor* executor, Closure* task) {
+  ExecutorBatch* batch = current_;
+  if (batch == NULL) {
+    executor->AddTask(task);
+    return;
+  }
+  task->next_closure = NULL;
+  std::vector<Pending>& pending = batch->pending_;
+  for (size_t i = 0; i < pending.size(); ++i) {
+    if (pending[i].executor == executor) {
+      pending[i].tail->next_closure = task;
+      pending[i].tail = task;
+      return;
+    }
+  }
+  Pending entry = { executor, task, task };
+  pending.push_back(entry);
+}
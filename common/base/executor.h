@@ -0,0 +1,78 @@
+#ifndef COMMON_BASE_EXECUTOR_H_
+#define COMMON_BASE_EXECUTOR_H_
+
+#include <vector>
+#include "common/base/callback.h"
+
+// An Executor runs Closures somewhere: on a ThreadPool, serially on a
+// strand, or right away on the calling thread.  Code handing work off (see
+// NewCallbackOn() in executor_callback.h) takes an Executor* so that the
+// caller picks where the work lands.
+class Executor {
+ public:
+  virtual ~Executor() {}
+
+  // Any thread.  Runs task once, now or later; like ThreadPool, relies on
+  // a NewCallback() task deleting itself when run.
+  virtual void AddTask(Closure* task) = 0;
+
+  // Any thread.  Adds the tasks linked from head through
+  // Closure::next_closure, in that order, as if by one AddTask() each.  The
+  // default does just that; executors override it to take the whole chain
+  // in one queue operation.
+  virtual void AddTasks(Closure* head);
+};
+
+// Runs each task on the thread adding it, before AddTask() returns.
+class InlineExecutor : public Executor {
+ public:
+  virtual void AddTask(Closure* task) {
+    task->Run();
+  }
+};
+
+// While an ExecutorBatch is alive on a thread, tasks that thread posts with
+// ExecutorBatch::Post() are held back, and handed to each executor with one
+// AddTasks() call when the batch is flushed: one queue push per executor
+// instead of one per task on a ThreadPool or Strand, whose workers still
+// run the tasks as they would have run them one by one.  Typical use is an
+// I/O loop completing a whole poll's worth of calls:
+//
+//   ExecutorBatch batch;
+//   for (int i = 0; i < num_events; ++i) {
+//     HandleEvent(events[i]);   // runs NewCallbackOn() callbacks
+//   }
+//   // ~ExecutorBatch() posts the collected tasks
+//
+// Batches nest; tasks go to the innermost one.  Everything posted through a
+// batch waits for the flush, including tasks for an InlineExecutor.
+class ExecutorBatch {
+ public:
+  ExecutorBatch();
+  // Flushes.
+  ~ExecutorBatch();
+
+  // Hands every task collected so far to its executor.
+  void Flush();
+
+  // Any thread.  executor->AddTask(task), or collects task into the
+  // calling thread's innermost ExecutorBatch if there is one.
+  static void Post(Executor* executor, Closure* task);
+
+ private:
+  // Tasks for one executor, linked through Closure::next_closure.
+  struct Pending {
+    Executor* executor;
+    Closure* head;
+    Closure* tail;
+  };
+
+  static __thread ExecutorBatch* current_;
+
+  ExecutorBatch* outer_;
+  std::vector<Pending> pending_;
+
+  DISALLOW_COPY_AND_ASSIGN(ExecutorBatch);
+};
+
+#endif  // COMMON_BASE_EXECUTOR_H_
@@ -0,0 +1,100 @@
+#ifndef COMMON_BASE_EXECUTOR_CALLBACK_H_
+#define COMMON_BASE_EXECUTOR_CALLBACK_H_
+
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "common/base/callback.h"
+#include "common/base/executor.h"
+
+// NewCallbackOn(executor, ...) takes the arguments of NewCallback() and
+// returns a callback which, when run, doesn't call its target but posts the
+// call to executor (through ExecutorBatch::Post(), so that an ExecutorBatch
+// on the running thread can coalesce the posts):
+//
+//   // HandleResponse runs on pool, not on the I/O thread completing the call
+//   Closure* done = NewCallbackOn(&pool, this, &Handler::HandleResponse,
+//                                 controller);
+//   stub->Search(controller, request, response, done);
+//
+// The result is a plain Callback<void(Args...)> (a Closure when no
+// arguments are left), so it goes wherever a NewCallback() one does, e.g.
+// as the done of RpcActionRunner::RunAction().  Run() it at most once.  The
+// call-time arguments are copied, as their decayed types, to be passed on
+// from the executor.  NewCallbackOn(executor, callback) binds an existing
+// callback the same way; a repeatable one stays with its owner.
+template <typename Signature>
+class ExecutorCallback;
+
+template <typename... Args>
+class ExecutorCallback<void(Args...)> : public Callback<void(Args...)> {
+ public:
+  ExecutorCallback(Executor* executor, Callback<void(Args...)>* callback)
+      : executor_(executor), callback_(callback), task_(this) {}
+
+  // Deleted without having run: so is the target, unless repeatable.
+  virtual ~ExecutorCallback() {
+    if (callback_ != NULL && !callback_->IsRepeatable()) {
+      delete callback_;
+    }
+  }
+
+  virtual bool IsRepeatable() const { return false; }
+
+  virtual void Run(Args... args) {
+    new (&arguments_) Arguments(std::forward<Args>(args)...);
+    ExecutorBatch::Post(executor_, &task_);
+  }
+
+ private:
+  typedef std::tuple<typename std::decay<Args>::type...> Arguments;
+
+  // Runs the target on the executor.
+  class Task : public Closure {
+   public:
+    explicit Task(ExecutorCallback* owner) : owner_(owner) {}
+    virtual bool IsRepeatable() const { return true; }
+    virtual void Run() {
+      owner_->RunTarget(
+          typename MakeCallbackIndexes<sizeof...(Args)>::type());
+    }
+   private:
+    ExecutorCallback* owner_;
+  };
+
+  template <size_t... Indexes>
+  void RunTarget(CallbackIndexes<Indexes...>) {
+    CallbackAutoDeleter<ExecutorCallback, true> self_deleter(this);
+    Arguments& arguments = *reinterpret_cast<Arguments*>(&arguments_);
+    Callback<void(Args...)>* callback = callback_;
+    callback_ = NULL;
+    callback->Run(
+        CallbackPreArg<true, Args>::Pass(std::get<Indexes>(arguments))...);
+    arguments.~Arguments();
+  }
+
+  Executor* executor_;
+  Callback<void(Args...)>* callback_;
+  Task task_;
+  typename std::aligned_storage<sizeof(Arguments),
+                                alignof(Arguments)>::type arguments_;
+
+  DISALLOW_COPY_AND_ASSIGN(ExecutorCallback);
+};
+
+template <typename... Args>
+Callback<void(Args...)>* NewCallbackOn(Executor* executor,
+                                       Callback<void(Args...)>* callback) {
+  return new ExecutorCallback<void(Args...)>(executor, callback);
+}
+
+template <typename... BindArgs>
+auto NewCallbackOn(Executor* executor, BindArgs&&... bind_args)
+    -> decltype(NewCallbackOn(
+        executor, NewCallback(std::forward<BindArgs>(bind_args)...))) {
+  return NewCallbackOn(executor,
+                       NewCallback(std::forward<BindArgs>(bind_args)...));
+}
+
+#endif  // COMMON_BASE_EXECUTOR_CALLBACK_H_
@@ -0,0 +1,208 @@
+#include "common/base/executor_callback.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "common/base/thread_pool.h"
+#include "thirdparty/gtest/gtest.h"
+
+// Keeps the tasks added to it until told to run them.
+class ManualExecutor : public Executor {
+ public:
+  ManualExecutor() : num_chains_(0) {}
+
+  virtual void AddTask(Closure* task) {
+    tasks_.push_back(task);
+  }
+
+  virtual void AddTasks(Closure* head) {
+    ++num_chains_;
+    Executor::AddTasks(head);
+  }
+
+  size_t num_tasks() const {
+    return tasks_.size();
+  }
+
+  // AddTasks() calls.
+  int num_chains() const {
+    return num_chains_;
+  }
+
+  void RunAll() {
+    std::vector<Closure*> tasks;
+    tasks.swap(tasks_);
+    for (size_t i = 0; i < tasks.size(); ++i) {
+      tasks[i]->Run();
+    }
+  }
+
+ private:
+  std::vector<Closure*> tasks_;
+  int num_chains_;
+};
+
+static void Append(std::vector<std::string>* log, const std::string& tag,
+                   const std::string& event) {
+  log->push_back(tag + ":" + event);
+}
+
+TEST(ExecutorCallbackTest, RunPostsToExecutor) {
+  ManualExecutor executor;
+  std::vector<std::string> log;
+  Callback<void(const std::string&)>* callback =
+      NewCallbackOn(&executor, &Append, &log, std::string("a"));
+  EXPECT_FALSE(callback->IsRepeatable());
+  {
+    std::string event("done");
+    callback->Run(event);
+  }
+  EXPECT_TRUE(log.empty());
+  EXPECT_EQ(1u, executor.num_tasks());
+  executor.RunAll();
+  ASSERT_EQ(1u, log.size());
+  EXPECT_EQ("a:done", log[0]);
+}
+
+TEST(ExecutorCallbackTest, InlineExecutor) {
+  InlineExecutor executor;
+  std::vector<std::string> log;
+  NewCallbackOn(&executor, &Append, &log)->Run("a", "b");
+  ASSERT_EQ(1u, log.size());
+  EXPECT_EQ("a:b", log[0]);
+}
+
+class Counter {
+ public:
+  Counter() : count_(0) {}
+  void Add(int n) { count_ += n; }
+  int count() const { return count_; }
+ private:
+  int count_;
+};
+
+TEST(ExecutorCallbackTest, BindExistingCallback) {
+  ManualExecutor executor;
+  Counter counter;
+  Callback<void(int)>* permanent =
+      NewPermanentCallback(&counter, &Counter::Add);
+  NewCallbackOn(&executor, permanent)->Run(2);
+  NewCallbackOn(&executor, permanent)->Run(3);
+  executor.RunAll();
+  EXPECT_EQ(5, counter.count());
+  delete permanent;
+}
+
+TEST(ExecutorCallbackTest, MoveOnlyArgument) {
+  ManualExecutor executor;
+  int value = 0;
+  Callback<void(std::unique_ptr<int>)>* callback = NewCallbackOn(
+      &executor, [&value](std::unique_ptr<int> p) { value = *p; });
+  callback->Run(std::unique_ptr<int>(new int(7)));
+  executor.RunAll();
+  EXPECT_EQ(7, value);
+}
+
+// Deleting a callback which never ran deletes the target with it.
+TEST(ExecutorCallbackTest, DeleteWithoutRun) {
+  ManualExecutor executor;
+  Counter counter;
+  delete NewCallbackOn(&executor, &counter, &Counter::Add);
+  EXPECT_EQ(0u, executor.num_tasks());
+}
+
+TEST(ExecutorCallbackTest, BatchCoalescesPerExecutor) {
+  ManualExecutor first;
+  ManualExecutor second;
+  std::vector<std::string> log;
+  {
+    ExecutorBatch batch;
+    for (int i = 0; i < 5; ++i) {
+      NewCallbackOn(&first, &Append, &log, "first")->Run(std::to_string(i));
+    }
+    NewCallbackOn(&second, &Append, &log, "second")->Run("0");
+    EXPECT_EQ(0u, first.num_tasks());
+    EXPECT_EQ(0u, second.num_tasks());
+  }
+  EXPECT_EQ(1, first.num_chains());
+  EXPECT_EQ(1, second.num_chains());
+  EXPECT_EQ(5u, first.num_tasks());
+  EXPECT_EQ(1u, second.num_tasks());
+  first.RunAll();
+  ASSERT_EQ(5u, log.size());
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_EQ("first:" + std::to_string(i), log[i]);
+  }
+  second.RunAll();
+  ASSERT_EQ(6u, log.size());
+  EXPECT_EQ("second:0", log[5]);
+}
+
+static void PostAgain(Executor* executor, Counter* counter, int depth) {
+  counter->Add(1);
+  if (depth > 0) {
+    NewCallbackOn(executor, &PostAgain, executor, counter, depth - 1)->Run();
+  }
+}
+
+// Posts made while flushing are flushed too.
+TEST(ExecutorCallbackTest, BatchWithInlineExecutor) {
+  InlineExecutor executor;
+  Counter counter;
+  {
+    ExecutorBatch batch;
+    NewCallbackOn(&executor, &PostAgain, &executor, &counter, 3)->Run();
+    EXPECT_EQ(0, counter.count());
+  }
+  EXPECT_EQ(4, counter.count());
+}
+
+static void CountOnWorker(ThreadPool* pool, std::atomic<int>* count) {
+  if (pool->IsWorkerThread()) {
+    count->fetch_add(1);
+  }
+}
+
+TEST(ExecutorCallbackTest, ThreadPool) {
+  ThreadPool pool(2);
+  std::atomic<int> count(0);
+  {
+    ExecutorBatch batch;
+    for (int i = 0; i < 100; ++i) {
+      NewCallbackOn(&pool, &CountOnWorker, &pool, &count)->Run();
+    }
+    batch.Flush();
+    for (int i = 0; i < 100; ++i) {
+      NewCallbackOn(&pool, &CountOnWorker, &pool, &count)->Run();
+    }
+  }
+  pool.WaitForIdle();
+  EXPECT_EQ(200, count.load());
+}
+
+// Meets the other task, which only gets there if they run in parallel.
+static void Meet(std::atomic<int>* arrived, std::atomic<int>* met) {
+  arrived->fetch_add(1);
+  for (int i = 0; i < 1000000 && arrived->load() < 2; ++i) {
+    std::this_thread::yield();
+  }
+  if (arrived->load() == 2) {
+    met->fetch_add(1);
+  }
+}
+
+// A batch doesn't serialize the tasks it hands to a ThreadPool.
+TEST(ExecutorCallbackTest, BatchRunsInParallelOnThreadPool) {
+  ThreadPool pool(2);
+  std::atomic<int> arrived(0);
+  std::atomic<int> met(0);
+  {
+    ExecutorBatch batch;
+    NewCallbackOn(&pool, &Meet, &arrived, &met)->Run();
+    NewCallbackOn(&pool, &Meet, &arrived, &met)->Run();
+  }
+  pool.WaitForIdle();
+  EXPECT_EQ(2, met.load());
+}
@@ -0,0 +1,574 @@
+#ifndef COMMON_BASE_FUTURE_H_
+#define COMMON_BASE_FUTURE_H_
+
+#include <stddef.h>
+#include <atomic>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "common/base/callback.h"
+#include "common/base/callback_pool.h"
+#include "thirdparty/glog/logging.h"
+
+// Future<T>/Promise<T> carry one value of type T (or just completion, for
+// T = void) from the code producing it to a continuation.
+//
+//   Promise<Response> promise;
+//   Future<Response> future = promise.GetFuture();
+//   future.Then(NewCallback(this, &Handler::OnResponse));
+//   ...
+//   promise.SetValue(response);   // runs OnResponse(response)
+//
+// Promise<void>::ToCallback() turns a promise into a Closure, which can be
+// passed wherever a done closure is expected:
+//
+//   std::vector<Future<void> > done;
+//   for (size_t i = 0; i < actions.size(); ++i) {
+//     Promise<void> promise;
+//     done.push_back(promise.GetFuture());
+//     actions[i]->CallService(context, promise.ToCallback());
+//   }
+//   WhenAll(done).Then(NewCallback(this, &StateRunner::HandleStateDone));
+//
+// The promise and its futures share one reference counted state object,
+// allocated from CallbackPool like callbacks are.  A future takes at most one
+// continuation, which is run exactly once: by SetValue() if it comes later,
+// or by Then() if the value is already there.  Then() with a Callback<> adds
+// no allocation; Then() with a lambda allocates the wrapping callback and the
+// state of the returned future, both from CallbackPool.  So the fan-out above
+// allocates a state and a ToCallback() callback per action, plus the WhenAll
+// continuation and the state of its future.
+//
+// Promise<void>::ToCallbacks(n) does the same fan-out with one promise: its
+// n closures live in a single block, and the promise is set once all of them
+// have run.  That is two objects, the state and the block, however many
+// actions there are:
+//
+//   Promise<void> promise;
+//   Future<void> all = promise.GetFuture();
+//   PromiseFanOut* fan_out = promise.ToCallbacks(actions.size());
+//   for (size_t i = 0; i < actions.size(); ++i) {
+//     actions[i]->CallService(context, fan_out->callback(i));
+//   }
+//   all.Then(NewCallback(this, &StateRunner::HandleStateDone));
+//
+// Every promise must be fulfilled; a continuation waiting on a promise which
+// is destroyed unfulfilled is never run, nor deleted.
+
+template <typename T> class Future;
+template <typename T> class Promise;
+template <typename R> struct FutureFulfill;
+class PromiseFanOut;
+
+// The value slot of a FutureState, and the callback types which go with it.
+template <typename T>
+class FutureValue {
+ public:
+  typedef Callback<void(const T&)> Continuation;
+  typedef Callback<void(T)> Setter;
+
+  template <typename... Args>
+  void Construct(Args&&... args) {
+    new (&storage_) T(std::forward<Args>(args)...);
+  }
+  void Destroy() {
+    Get().~T();
+  }
+  const T& Get() const {
+    return *reinterpret_cast<const T*>(&storage_);
+  }
+  void Run(Continuation* continuation) const {
+    continuation->Run(Get());
+  }
+
+ private:
+  typename std::aligned_storage<sizeof(T), alignof(T)>::type storage_;
+};
+
+template <>
+class FutureValue<void> {
+ public:
+  typedef Closure Continuation;
+  typedef Closure Setter;
+
+  void Construct() {}
+  void Destroy() {}
+  void Run(Continuation* continuation) const {
+    continuation->Run();
+  }
+};
+
+template <typename T>
+class FutureState : public CallbackPoolObject {
+ public:
+  typedef typename FutureValue<T>::Continuation Continuation;
+
+  FutureState() : references_(1), state_(kPending), continuation_(NULL) {}
+  ~FutureState() {
+    int state = state_.load(std::memory_order_relaxed);
+    if (state == kReady || state == kDone) {
+      value_.Destroy();
+    }
+  }
+
+  void AddReference() {
+    references_.fetch_add(1, std::memory_order_relaxed);
+  }
+  void Release() {
+    if (references_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      delete this;
+    }
+  }
+
+  template <typename... Args>
+  void SetValue(Args&&... args) {
+    int state = state_.load(std::memory_order_relaxed);
+    CHECK(state == kPending || state == kHasContinuation)
+        << "SetValue on a future which has its value already";
+    value_.Construct(std::forward<Args>(args)...);
+    int expected = kPending;
+    if (!state_.compare_exchange_strong(expected, kReady,
+                                        std::memory_order_acq_rel)) {
+      CHECK_EQ(kHasContinuation, expected)
+          << "SetValue on a future which has its value already";
+      // Then() came first.
+      state_.store(kDone, std::memory_order_release);
+      value_.Run(continuation_);
+    }
+  }
+
+  void SetContinuation(Continuation* continuation) {
+    int state = state_.load(std::memory_order_relaxed);
+    CHECK(state == kPending || state == kReady)
+        << "Then on a future which has its continuation already";
+    continuation_ = continuation;
+    int expected = kPending;
+    if (!state_.compare_exchange_strong(expected, kHasContinuation,
+                                        std::memory_order_acq_rel)) {
+      CHECK_EQ(kReady, expected)
+          << "Then on a future which has its continuation already";
+      // SetValue() came first.
+      state_.store(kDone, std::memory_order_release);
+      value_.Run(continuation_);
+    }
+  }
+
+  bool IsReady() const {
+    int state = state_.load(std::memory_order_acquire);
+    return state == kReady || state == kDone;
+  }
+
+  const FutureValue<T>& value() const {
+    return value_;
+  }
+
+ private:
+  enum {
+    kPending,
+    kHasContinuation,
+    kReady,
+    kDone,
+  };
+
+  std::atomic<int> references_;
+  std::atomic<int> state_;
+  Continuation* continuation_;
+  FutureValue<T> value_;
+};
+
+// Result type of a Then() functor.  Empty unless Functor is a class, so
+// Then(Continuation*) isn't shadowed by the functor overload.
+template <typename T, typename Functor,
+          bool IsClass = std::is_class<Functor>::value>
+struct FutureThenResult {};
+
+template <typename T, typename Functor>
+struct FutureThenResult<T, Functor, true> {
+  typedef decltype(std::declval<Functor&>()(std::declval<const T&>())) type;
+};
+
+template <typename Functor>
+struct FutureThenResult<void, Functor, true> {
+  typedef decltype(std::declval<Functor&>()()) type;
+};
+
+// The continuation Then(functor) installs.
+template <typename Functor, typename R, typename CallbackType>
+class FutureThenCallback;
+
+template <typename Functor, typename R, typename... Args>
+class FutureThenCallback<Functor, R, Callback<void(Args...)> >
+    : public Callback<void(Args...)> {
+ public:
+  template <typename F>
+  FutureThenCallback(F&& functor, Promise<R>&& promise)
+      : functor_(std::forward<F>(functor)), promise_(std::move(promise)) {}
+  virtual bool IsRepeatable() const { return false; }
+  virtual void Run(Args... args) {
+    CallbackAutoDeleter<FutureThenCallback, true> self_deleter(this);
+    FutureFulfill<R>::Apply(&promise_, functor_, std::forward<Args>(args)...);
+  }
+
+ private:
+  Functor functor_;
+  Promise<R> promise_;
+};
+
+// The callback Promise::ToCallback() returns.
+template <typename T, typename CallbackType>
+class PromiseCallback;
+
+template <typename T, typename... Args>
+class PromiseCallback<T, Callback<void(Args...)> >
+    : public Callback<void(Args...)> {
+ public:
+  explicit PromiseCallback(Promise<T>&& promise)
+      : promise_(std::move(promise)) {}
+  virtual bool IsRepeatable() const { return false; }
+  virtual void Run(Args... args) {
+    CallbackAutoDeleter<PromiseCallback, true> self_deleter(this);
+    promise_.SetValue(std::forward<Args>(args)...);
+  }
+
+ private:
+  Promise<T> promise_;
+};
+
+template <typename T>
+class Future {
+ public:
+  typedef typename FutureValue<T>::Continuation Continuation;
+
+  Future() : state_(NULL) {}
+  Future(const Future& other) : state_(other.state_) {
+    if (state_ != NULL) {
+      state_->AddReference();
+    }
+  }
+  Future(Future&& other) : state_(other.state_) {
+    other.state_ = NULL;
+  }
+  Future& operator=(Future other) {
+    std::swap(state_, other.state_);
+    return *this;
+  }
+  ~Future() {
+    if (state_ != NULL) {
+      state_->Release();
+    }
+  }
+
+  // False for a default constructed or moved from future.
+  bool valid() const {
+    return state_ != NULL;
+  }
+
+  bool IsReady() const {
+    return state_->IsReady();
+  }
+
+  // Only once IsReady().
+  template <typename U = T>
+  const U& value() const {
+    return state_->value().Get();
+  }
+
+  // Runs continuation with the value once it is set.  At most one Then()
+  // per promise, whichever future of it is used, and WhenAll()/WhenAny()
+  // use it up too; a second one fails a CHECK.
+  void Then(Continuation* continuation) {
+    state_->SetContinuation(continuation);
+  }
+
+  // Runs functor(value) (functor() for Future<void>) once the value is
+  // set, and returns a future of its result.
+  template <typename Functor>
+  Future<typename FutureThenResult<T, typename std::decay<Functor>::type>::type>
+  Then(Functor&& functor) {
+    typedef typename std::decay<Functor>::type FunctorType;
+    typedef typename FutureThenResult<T, FunctorType>::type R;
+    Promise<R> promise;
+    Future<R> future = promise.GetFuture();
+    Then(new FutureThenCallback<FunctorType, R, Continuation>(
+        std::forward<Functor>(functor), std::move(promise)));
+    return future;
+  }
+
+ private:
+  friend class Promise<T>;
+  template <typename U>
+  friend Future<void> WhenAll(const std::vector<Future<U> >& futures);
+  template <typename U>
+  friend Future<size_t> WhenAny(const std::vector<Future<U> >& futures);
+
+  // Takes a new reference to state.
+  explicit Future(FutureState<T>* state) : state_(state) {
+    state_->AddReference();
+  }
+
+  FutureState<T>* state_;
+};
+
+template <typename T>
+class Promise {
+ public:
+  Promise() : state_(new FutureState<T>) {}
+  Promise(Promise&& other) : state_(other.state_) {
+    other.state_ = NULL;
+  }
+  Promise& operator=(Promise&& other) {
+    std::swap(state_, other.state_);
+    return *this;
+  }
+  ~Promise() {
+    if (state_ != NULL) {
+      state_->Release();
+    }
+  }
+
+  Future<T> GetFuture() {
+    return Future<T>(state_);
+  }
+
+  // Once.  Runs the continuation, if there is one already.
+  template <typename... Args>
+  void SetValue(Args&&... args) {
+    state_->SetValue(std::forward<Args>(args)...);
+  }
+
+  // Moves the promise into a self-deleting callback which sets the value
+  // it is run with; a Closure for Promise<void>.
+  typename FutureValue<T>::Setter* ToCallback() {
+    return new PromiseCallback<T, typename FutureValue<T>::Setter>(
+        std::move(*this));
+  }
+
+  // Promise<void> only.  Moves the promise into a block of count closures,
+  // each to be run once, which sets the value once all of them have run.
+  // Returns NULL, having set the value, if count is 0.
+  PromiseFanOut* ToCallbacks(size_t count);
+
+ private:
+  Promise(const Promise&);
+  void operator=(const Promise&);
+
+  FutureState<T>* state_;
+};
+
+// Fulfills a promise with the result of a Then() functor.
+template <typename R>
+struct FutureFulfill {
+  template <typename Functor, typename... Args>
+  static void Apply(Promise<R>* promise, Functor& functor, Args&&... args) {
+    promise->SetValue(functor(std::forward<Args>(args)...));
+  }
+};
+
+template <>
+struct FutureFulfill<void> {
+  template <typename Functor, typename... Args>
+  static void Apply(Promise<void>* promise, Functor& functor,
+                    Args&&... args) {
+    functor(std::forward<Args>(args)...);
+    promise->SetValue();
+  }
+};
+
+// The closures Promise<void>::ToCallbacks() returns, allocated in one block
+// right after this header.  Like WhenAny()'s slots they are repeatable, so
+// that nobody deletes them; the block goes away once the last one has run,
+// so don't touch it after handing out the last callback.
+class PromiseFanOut {
+ public:
+  static PromiseFanOut* Create(Promise<void>&& promise, size_t count) {
+    void* block = CallbackPool::Allocate(BlockSize(count));
+    return new (block) PromiseFanOut(std::move(promise), count);
+  }
+
+  Closure* callback(size_t index) {
+    return &slots()[index];
+  }
+
+ private:
+  class Slot : public Closure {
+   public:
+    explicit Slot(PromiseFanOut* owner) : owner_(owner) {}
+    virtual bool IsRepeatable() const { return true; }
+    virtual void Run() {
+      owner_->Arrive();
+    }
+
+   private:
+    PromiseFanOut* owner_;
+  };
+
+  PromiseFanOut(Promise<void>&& promise, size_t count)
+      : promise_(std::move(promise)), count_(count), pending_(count) {
+    for (size_t i = 0; i < count; ++i) {
+      new (&slots()[i]) Slot(this);
+    }
+  }
+  ~PromiseFanOut() {
+    for (size_t i = 0; i < count_; ++i) {
+      slots()[i].~Slot();
+    }
+  }
+
+  static size_t BlockSize(size_t count) {
+    return sizeof(PromiseFanOut) + count * sizeof(Slot);
+  }
+
+  Slot* slots() {
+    return reinterpret_cast<Slot*>(this + 1);
+  }
+
+  void Arrive() {
+    if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      Promise<void> promise(std::move(promise_));
+      size_t count = count_;
+      this->~PromiseFanOut();
+      CallbackPool::Deallocate(this, BlockSize(count));
+      promise.SetValue();
+    }
+  }
+
+  Promise<void> promise_;
+  size_t count_;
+  std::atomic<size_t> pending_;
+};
+
+static_assert(sizeof(PromiseFanOut) % alignof(Closure) == 0,
+              "PromiseFanOut slots would be misaligned");
+
+template <typename T>
+PromiseFanOut* Promise<T>::ToCallbacks(size_t count) {
+  static_assert(std::is_void<T>::value,
+                "ToCallbacks() is for Promise<void> only");
+  if (count == 0) {
+    SetValue();
+    return NULL;
+  }
+  return PromiseFanOut::Create(std::move(*this), count);
+}
+
+// The continuation WhenAll() installs on all its inputs.  It is repeatable,
+// so the input states leave it alone, and deletes itself when the last one
+// has arrived.
+template <typename CallbackType>
+class FutureWhenAll;
+
+template <typename... Args>
+class FutureWhenAll<Callback<void(Args...)> >
+    : public Callback<void(Args...)> {
+ public:
+  explicit FutureWhenAll(size_t count) : pending_(count) {}
+  virtual bool IsRepeatable() const { return true; }
+  virtual void Run(Args... args) {
+    Arrive();
+  }
+
+  Future<void> GetFuture() {
+    return promise_.GetFuture();
+  }
+
+  void Arrive() {
+    if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      Promise<void> promise(std::move(promise_));
+      delete this;
+      promise.SetValue();
+    }
+  }
+
+ private:
+  std::atomic<size_t> pending_;
+  Promise<void> promise_;
+};
+
+// Returns a future which is ready once all of futures are.  Uses up the
+// Then() of each of them; their values stay readable through futures.
+template <typename T>
+Future<void> WhenAll(const std::vector<Future<T> >& futures) {
+  typedef FutureWhenAll<typename FutureValue<T>::Continuation> Barrier;
+  // One extra arrival, so the result can't be set while still installing.
+  Barrier* barrier = new Barrier(futures.size() + 1);
+  Future<void> all = barrier->GetFuture();
+  for (size_t i = 0; i < futures.size(); ++i) {
+    futures[i].state_->SetContinuation(barrier);
+  }
+  barrier->Arrive();
+  return all;
+}
+
+template <typename CallbackType>
+class FutureWhenAny;
+
+template <typename... Args>
+class FutureWhenAny<Callback<void(Args...)> > {
+ public:
+  explicit FutureWhenAny(size_t count)
+      : slots_(new Slot[count]), remaining_(count), fired_(false) {
+    for (size_t i = 0; i < count; ++i) {
+      slots_[i].owner = this;
+      slots_[i].index = i;
+    }
+  }
+
+  Future<size_t> GetFuture() {
+    return promise_.GetFuture();
+  }
+
+  Callback<void(Args...)>* slot(size_t index) {
+    return &slots_[index];
+  }
+
+ private:
+  class Slot : public Callback<void(Args...)> {
+   public:
+    virtual bool IsRepeatable() const { return true; }
+    virtual void Run(Args... args) {
+      owner->Arrive(index);
+    }
+
+    FutureWhenAny* owner;
+    size_t index;
+  };
+
+  void Arrive(size_t index) {
+    if (!fired_.exchange(true, std::memory_order_acq_rel)) {
+      promise_.SetValue(index);
+    }
+    if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      delete this;
+    }
+  }
+
+  std::unique_ptr<Slot[]> slots_;
+  std::atomic<size_t> remaining_;
+  std::atomic<bool> fired_;
+  Promise<size_t> promise_;
+};
+
+// Returns a future of the index of the first of futures to become ready,
+// or of futures.size() at once if futures is empty.  Uses up the Then() of
+// each of them; their values stay readable through futures.  All of futures
+// must still become ready eventually.
+template <typename T>
+Future<size_t> WhenAny(const std::vector<Future<T> >& futures) {
+  typedef FutureWhenAny<typename FutureValue<T>::Continuation> Selector;
+  if (futures.empty()) {
+    Promise<size_t> promise;
+    Future<size_t> none = promise.GetFuture();
+    promise.SetValue(futures.size());
+    return none;
+  }
+  Selector* selector = new Selector(futures.size());
+  Future<size_t> any = selector->GetFuture();
+  for (size_t i = 0; i < futures.size(); ++i) {
+    futures[i].state_->SetContinuation(selector->slot(i));
+  }
+  return any;
+}
+
+#endif  // COMMON_BASE_FUTURE_H_
@@ -0,0 +1,261 @@
+#include "common/base/future.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "thirdparty/gtest/gtest.h"
+
+static void Store(int* result, const int& value) {
+  *result = value;
+}
+
+static void Inc(int* count) {
+  ++*count;
+}
+
+TEST(FutureTest, ThenBeforeSetValue) {
+  Promise<int> promise;
+  Future<int> future = promise.GetFuture();
+  EXPECT_TRUE(future.valid());
+  EXPECT_FALSE(future.IsReady());
+  int result = 0;
+  future.Then(NewCallback(&Store, &result));
+  EXPECT_EQ(0, result);
+  promise.SetValue(42);
+  EXPECT_EQ(42, result);
+  EXPECT_TRUE(future.IsReady());
+  EXPECT_EQ(42, future.value());
+}
+
+TEST(FutureTest, ThenAfterSetValue) {
+  Promise<int> promise;
+  Future<int> future = promise.GetFuture();
+  promise.SetValue(7);
+  EXPECT_TRUE(future.IsReady());
+  int result = 0;
+  future.Then(NewCallback(&Store, &result));
+  EXPECT_EQ(7, result);
+}
+
+TEST(FutureTest, VoidFuture) {
+  Promise<void> promise;
+  Future<void> future = promise.GetFuture();
+  int count = 0;
+  future.Then(NewCallback(&Inc, &count));
+  promise.SetValue();
+  EXPECT_EQ(1, count);
+}
+
+TEST(FutureTest, SecondThenDies) {
+  Promise<int> promise;
+  Future<int> future = promise.GetFuture();
+  Future<int> copy = future;
+  int result = 0;
+  future.Then(NewCallback(&Store, &result));
+  Callback<void(const int&)>* second = NewCallback(&Store, &result);
+  EXPECT_DEATH(copy.Then(second), "kReady");
+  promise.SetValue(1);
+  EXPECT_EQ(1, result);
+  delete second;
+  // After the value is there too.
+  EXPECT_DEATH(copy.Then([](const int& value) {}), "kReady");
+}
+
+TEST(FutureTest, SetValueTwiceDies) {
+  Promise<int> promise;
+  promise.SetValue(1);
+  EXPECT_DEATH(promise.SetValue(2), "kHasContinuation");
+  Promise<int> waited;
+  int result = 0;
+  waited.GetFuture().Then(NewCallback(&Store, &result));
+  waited.SetValue(3);
+  EXPECT_EQ(3, result);
+  EXPECT_DEATH(waited.SetValue(4), "kHasContinuation");
+}
+
+TEST(FutureTest, StateOutlivesPromise) {
+  Future<std::string> future;
+  {
+    Promise<std::string> promise;
+    future = promise.GetFuture();
+    promise.SetValue("abc");
+  }
+  EXPECT_EQ("abc", future.value());
+}
+
+TEST(FutureTest, ValueIsDestroyed) {
+  std::shared_ptr<int> value(new int(1));
+  {
+    Promise<std::shared_ptr<int> > promise;
+    promise.SetValue(value);
+    EXPECT_EQ(2, value.use_count());
+  }
+  EXPECT_EQ(1, value.use_count());
+}
+
+TEST(FutureTest, ThenChain) {
+  Promise<int> promise;
+  std::string result;
+  promise.GetFuture()
+      .Then([](const int& a) { return a * 2; })
+      .Then([](const int& a) { return std::to_string(a); })
+      .Then([&result](const std::string& s) { result = s; });
+  EXPECT_EQ("", result);
+  promise.SetValue(21);
+  EXPECT_EQ("42", result);
+}
+
+TEST(FutureTest, ThenOnVoid) {
+  Promise<void> promise;
+  Future<int> future = promise.GetFuture().Then([]() { return 5; });
+  EXPECT_FALSE(future.IsReady());
+  promise.SetValue();
+  ASSERT_TRUE(future.IsReady());
+  EXPECT_EQ(5, future.value());
+}
+
+TEST(FutureTest, PromiseAsClosure) {
+  Promise<void> promise;
+  Future<void> future = promise.GetFuture();
+  Closure* done = promise.ToCallback();
+  EXPECT_FALSE(future.IsReady());
+  done->Run();
+  EXPECT_TRUE(future.IsReady());
+
+  Promise<int> int_promise;
+  Future<int> int_future = int_promise.GetFuture();
+  Callback<void(int)>* set = int_promise.ToCallback();
+  set->Run(3);
+  EXPECT_EQ(3, int_future.value());
+}
+
+TEST(FutureTest, WhenAll) {
+  std::vector<Promise<int> > promises(3);
+  std::vector<Future<int> > futures;
+  for (size_t i = 0; i < promises.size(); ++i) {
+    futures.push_back(promises[i].GetFuture());
+  }
+  int count = 0;
+  WhenAll(futures).Then(NewCallback(&Inc, &count));
+  promises[2].SetValue(2);
+  promises[0].SetValue(0);
+  EXPECT_EQ(0, count);
+  promises[1].SetValue(1);
+  EXPECT_EQ(1, count);
+  for (size_t i = 0; i < futures.size(); ++i) {
+    EXPECT_EQ(static_cast<int>(i), futures[i].value());
+  }
+}
+
+TEST(FutureTest, WhenAllReadyOrEmpty) {
+  std::vector<Future<void> > futures;
+  EXPECT_TRUE(WhenAll(futures).IsReady());
+  Promise<void> promise;
+  futures.push_back(promise.GetFuture());
+  promise.SetValue();
+  EXPECT_TRUE(WhenAll(futures).IsReady());
+}
+
+TEST(FutureTest, ThenAfterWhenAllDies) {
+  Promise<void> promise;
+  std::vector<Future<void> > futures(1, promise.GetFuture());
+  WhenAll(futures);
+  EXPECT_DEATH(futures[0].Then([]() {}), "kReady");
+  promise.SetValue();
+}
+
+TEST(FutureTest, WhenAny) {
+  std::vector<Promise<void> > promises(3);
+  std::vector<Future<void> > futures;
+  for (size_t i = 0; i < promises.size(); ++i) {
+    futures.push_back(promises[i].GetFuture());
+  }
+  Future<size_t> any = WhenAny(futures);
+  EXPECT_FALSE(any.IsReady());
+  promises[1].SetValue();
+  ASSERT_TRUE(any.IsReady());
+  EXPECT_EQ(1u, any.value());
+  promises[0].SetValue();
+  promises[2].SetValue();
+  EXPECT_EQ(1u, any.value());
+}
+
+TEST(FutureTest, PromiseFanOut) {
+  Promise<void> promise;
+  Future<void> all = promise.GetFuture();
+  PromiseFanOut* fan_out = promise.ToCallbacks(3);
+  int count = 0;
+  all.Then(NewCallback(&Inc, &count));
+  Closure* first = fan_out->callback(0);
+  Closure* second = fan_out->callback(1);
+  Closure* third = fan_out->callback(2);
+  EXPECT_TRUE(first->IsRepeatable());
+  third->Run();
+  first->Run();
+  EXPECT_FALSE(all.IsReady());
+  second->Run();
+  EXPECT_TRUE(all.IsReady());
+  EXPECT_EQ(1, count);
+
+  Promise<void> none;
+  Future<void> empty = none.GetFuture();
+  EXPECT_TRUE(none.ToCallbacks(0) == NULL);
+  EXPECT_TRUE(empty.IsReady());
+}
+
+static void RunCallbacks(std::vector<Closure*>* callbacks, size_t begin,
+                         size_t end) {
+  for (size_t i = begin; i < end; ++i) {
+    (*callbacks)[i]->Run();
+  }
+}
+
+TEST(FutureTest, PromiseFanOutAcrossThreads) {
+  const size_t kThreadNum = 8;
+  const size_t kPerThread = 1000;
+  Promise<void> promise;
+  Future<void> all = promise.GetFuture();
+  PromiseFanOut* fan_out = promise.ToCallbacks(kThreadNum * kPerThread);
+  std::vector<Closure*> callbacks;
+  for (size_t i = 0; i < kThreadNum * kPerThread; ++i) {
+    callbacks.push_back(fan_out->callback(i));
+  }
+  std::vector<shared_ptr<Thread> > threads(kThreadNum);
+  for (size_t t = 0; t < kThreadNum; ++t) {
+    threads[t].reset(new Thread(NewCallback(
+        &RunCallbacks, &callbacks, t * kPerThread, (t + 1) * kPerThread)));
+    threads[t]->Start();
+  }
+  for (size_t t = 0; t < kThreadNum; ++t) {
+    threads[t]->Join();
+  }
+  EXPECT_TRUE(all.IsReady());
+}
+
+static void Fulfill(std::vector<Promise<int> >* promises, size_t begin,
+                    size_t end) {
+  for (size_t i = begin; i < end; ++i) {
+    (*promises)[i].SetValue(static_cast<int>(i));
+  }
+}
+
+TEST(FutureTest, WhenAllAcrossThreads) {
+  const size_t kThreadNum = 8;
+  const size_t kPerThread = 1000;
+  std::vector<Promise<int> > promises(kThreadNum * kPerThread);
+  std::vector<Future<int> > futures;
+  for (size_t i = 0; i < promises.size(); ++i) {
+    futures.push_back(promises[i].GetFuture());
+  }
+  Future<void> all = WhenAll(futures);
+  std::vector<shared_ptr<Thread> > threads(kThreadNum);
+  for (size_t t = 0; t < kThreadNum; ++t) {
+    threads[t].reset(new Thread(NewCallback(
+        &Fulfill, &promises, t * kPerThread, (t + 1) * kPerThread)));
+    threads[t]->Start();
+  }
+  for (size_t t = 0; t < kThreadNum; ++t) {
+    threads[t]->Join();
+  }
+  EXPECT_TRUE(all.IsReady());
+}
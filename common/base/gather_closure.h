@@ -0,0 +1,73 @@
+#ifndef COMMON_BASE_GATHER_CLOSURE_H_
+#define COMMON_BASE_GATHER_CLOSURE_H_
+
+#include <atomic>
+#include <type_traits>
+#include <vector>
+#include "common/base/callback.h"
+#include "thirdparty/glog/logging.h"
+
+// A BarrierClosure which also gathers one result of type T per participant.
+// Participant i writes its result into slot i, which nobody else touches,
+// and then arrives; the last arrival runs done with all n results, in
+// participant order and in one contiguous vector.  No locks, and nothing to
+// scan afterwards.
+//
+//   GatherClosure<int>* gather = new GatherClosure<int>(
+//       shards.size(), NewCallback(this, &Searcher::Merge));
+//   for (size_t i = 0; i < shards.size(); ++i) {
+//     shards[i]->Count(query, gather->mutable_result(i), gather);
+//   }
+//   ...
+//   void Searcher::Merge(std::vector<int>* counts);
+//
+// Set(i, value) writes slot i and arrives in one go.  Slots start value
+// initialized, so a participant may also just Run() to leave its result
+// empty.  done may move the results out; the gather closure deletes itself
+// after done returns.  T can't be bool, since std::vector<bool> packs the
+// slots into shared words; gather chars instead.
+template <typename T>
+class GatherClosure : public Closure {
+ public:
+  typedef Callback<void(std::vector<T>*)> Done;
+
+  GatherClosure(int n, Done* done) : results_(n), left_(n), done_(done) {
+    CHECK_GT(n, 0);
+  }
+
+  virtual bool IsRepeatable() const {
+    return false;
+  }
+
+  // Slot i; only participant i may touch it, and only before it arrives.
+  T* mutable_result(int i) {
+    return &results_[i];
+  }
+
+  void Set(int i, const T& value) {
+    results_[i] = value;
+    Run();
+  }
+
+  // Arrives; the results written before are visible to done.
+  virtual void Run() {
+    if (left_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      done_->Run(&results_);
+      delete this;
+    }
+  }
+
+ private:
+  static_assert(!std::is_same<T, bool>::value,
+                "GatherClosure<bool> would share bits between slots");
+
+  ~GatherClosure() {}
+
+  std::vector<T> results_;
+  std::atomic<int> left_;
+  Done* done_;
+
+  DISALLOW_COPY_AND_ASSIGN(GatherClosure);
+};
+
+#endif  // COMMON_BASE_GATHER_CLOSURE_H_
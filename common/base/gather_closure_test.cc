@@ -0,0 +1,53 @@
+#include "common/base/gather_closure.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+#include "thirdparty/gtest/gtest.h"
+
+template <typename T>
+static void TakeResults(std::vector<T>* out, std::vector<T>* results) {
+  out->swap(*results);
+}
+
+TEST(GatherClosureTest, ResultsInParticipantOrder) {
+  std::vector<std::string> results;
+  GatherClosure<std::string>* gather = new GatherClosure<std::string>(
+      3, NewCallback(&TakeResults<std::string>, &results));
+  gather->Set(2, "c");
+  *gather->mutable_result(0) = "a";
+  gather->Run();
+  EXPECT_TRUE(results.empty());
+  // Participant 1 leaves its slot empty.
+  gather->Run();
+  ASSERT_EQ(3u, results.size());
+  EXPECT_EQ("a", results[0]);
+  EXPECT_EQ("", results[1]);
+  EXPECT_EQ("c", results[2]);
+}
+
+static void Square(GatherClosure<int>* gather, int begin, int end) {
+  for (int i = begin; i < end; ++i) {
+    gather->Set(i, i * i);
+  }
+}
+
+TEST(GatherClosureTest, MultipleThreadTest) {
+  const int kThreadNum = 16;
+  const int kPerThread = 100;
+  std::vector<int> results;
+  GatherClosure<int>* gather = new GatherClosure<int>(
+      kThreadNum * kPerThread, NewCallback(&TakeResults<int>, &results));
+  std::vector<std::thread> threads;
+  for (int k = 0; k < kThreadNum; ++k) {
+    threads.push_back(std::thread(&Square, gather, k * kPerThread,
+                                  (k + 1) * kPerThread));
+  }
+  for (int k = 0; k < kThreadNum; ++k) {
+    threads[k].join();
+  }
+  ASSERT_EQ(static_cast<size_t>(kThreadNum * kPerThread), results.size());
+  for (size_t i = 0; i < results.size(); ++i) {
+    EXPECT_EQ(static_cast<int>(i * i), results[i]);
+  }
+}
@@ -0,0 +1,298 @@
+#ifndef COMMON_BASE_INLINE_CALLBACK_H_
+#define COMMON_BASE_INLINE_CALLBACK_H_
+
+#include <stddef.h>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "common/base/callback.h"
+
+// InlineCallback<R(Args...)> is a Callback<R(Args...)> which keeps its bound
+// target (object pointer, member function pointer and pre-bound arguments)
+// in a fixed-size buffer inside the callback object itself, instead of in a
+// heap object created by NewCallback.  It is meant to be embedded in the
+// object which hands it out, or put on the stack, and passed to anybody
+// expecting a Callback<R(Args...)>* (or a Closure*):
+//
+//   class Runner {
+//    public:
+//     void Start(Service* service) {
+//       done_.Bind(this, &Runner::OnDone, service);
+//       service->Call(&done_);
+//     }
+//    private:
+//     void OnDone(Service* service);
+//     InlineCallback<void()> done_;
+//   };
+//
+// Bind() has the semantics of NewCallback(): the callback can be Run() once,
+// after which it is unbound again.  The target is unbound *before* it is
+// called, so it may re-bind the same InlineCallback or destroy its owner
+// ("delete this") from inside the call.
+// BindPermanent() has the semantics of NewPermanentCallback().
+// Neither of them ever deletes the InlineCallback itself.
+//
+// Lambdas and other functors can be bound as well, with their captured
+// state kept in the same buffer.
+//
+// The bound target must fit in kStorageSize bytes; the default is enough for
+// an object pointer, a member function pointer and three pointer-sized
+// pre-bound arguments, or a lambda capturing six pointers.  Binding anything
+// bigger fails to compile.
+
+template <typename R, typename Class, typename MemberSignature>
+class InlineMemberFunctor {
+ public:
+  InlineMemberFunctor(Class* object, MemberSignature member)
+      : object_(object), member_(member) {}
+  template <typename... Params>
+  R operator()(Params&&... params) const {
+    return static_cast<R>((object_->*member_)(
+        std::forward<Params>(params)...));
+  }
+ private:
+  Class* object_;
+  MemberSignature member_;
+};
+
+template <typename R, typename FunctionType>
+class InlineFunctionFunctor {
+ public:
+  explicit InlineFunctionFunctor(FunctionType function)
+      : function_(function) {}
+  template <typename... Params>
+  R operator()(Params&&... params) const {
+    return static_cast<R>(function_(std::forward<Params>(params)...));
+  }
+ private:
+  FunctionType function_;
+};
+
+// Target and pre-bound arguments of an InlineCallback.  As in NewCallback,
+// the arguments are stored as bound (PreArgList) and converted to the
+// target's parameter types (PreParamList) only when it is called.
+template <typename R, typename Functor, typename PreParamList,
+          typename PreArgList>
+class InlineCallbackBinder;
+
+template <typename R, typename Functor, typename... PreParams,
+          typename... PreArgs>
+class InlineCallbackBinder<R, Functor, CallbackTypeList<PreParams...>,
+                           CallbackTypeList<PreArgs...> > {
+ public:
+  template <typename... BoundArgs>
+  explicit InlineCallbackBinder(Functor functor, BoundArgs&&... pre_args)
+      : functor_(std::move(functor)),
+        pre_args_(std::forward<BoundArgs>(pre_args)...) {}
+
+  // Pre-bound arguments are moved out when Once is true.
+  template <bool Once, typename... Args>
+  R Run(Args&&... args) {
+    return Apply<Once>(
+        typename MakeCallbackIndexes<sizeof...(PreParams)>::type(),
+        std::forward<Args>(args)...);
+  }
+
+ private:
+  template <bool Once, size_t... Indexes, typename... Args>
+  R Apply(CallbackIndexes<Indexes...>, Args&&... args) {
+    return static_cast<R>(functor_(
+        CallbackPreArg<Once, PreParams>::Pass(std::get<Indexes>(pre_args_))...,
+        std::forward<Args>(args)...));
+  }
+
+  Functor functor_;
+  std::tuple<PreArgs...> pre_args_;
+};
+
+template <typename Signature, size_t kStorageSize = 6 * sizeof(void*)>
+class InlineCallback;
+
+template <typename R, typename... Args, size_t kStorageSize>
+class InlineCallback<R(Args...), kStorageSize>
+    : public Callback<R(Args...)> {
+ public:
+  InlineCallback() : runner_(NULL), destroyer_(NULL), repeatable_(false) {}
+  virtual ~InlineCallback() { Reset(); }
+
+  // Same as NewCallback(object, member, pre_args...).
+  template <typename Result, typename Class, typename CallerClass,
+            typename... Params, typename... PreArgs>
+  void Bind(Class* object, Result (CallerClass::*member)(Params...),
+            PreArgs&&... pre_args) {
+    BindTarget<false, typename CallbackSignature<
+        Result, sizeof...(PreArgs), Params...>::PreParamList>(
+            InlineMemberFunctor<R, Class,
+                                Result (CallerClass::*)(Params...)>(
+                object, member),
+            std::forward<PreArgs>(pre_args)...);
+  }
+
+  // Same as NewCallback(const_object, const_member, pre_args...).
+  template <typename Result, typename Class, typename CallerClass,
+            typename... Params, typename... PreArgs>
+  void Bind(const Class* object,
+            Result (CallerClass::*member)(Params...) const,
+            PreArgs&&... pre_args) {
+    BindTarget<false, typename CallbackSignature<
+        Result, sizeof...(PreArgs), Params...>::PreParamList>(
+            InlineMemberFunctor<R, const Class,
+                                Result (CallerClass::*)(Params...) const>(
+                object, member),
+            std::forward<PreArgs>(pre_args)...);
+  }
+
+  // Same as NewCallback(function, pre_args...).
+  template <typename Result, typename... Params, typename... PreArgs>
+  void Bind(Result (*function)(Params...), PreArgs&&... pre_args) {
+    BindTarget<false, typename CallbackSignature<
+        Result, sizeof...(PreArgs), Params...>::PreParamList>(
+            InlineFunctionFunctor<R, Result (*)(Params...)>(function),
+            std::forward<PreArgs>(pre_args)...);
+  }
+
+  // Same as NewCallback(functor), e.g. for a lambda.  The functor is moved
+  // or copied into the storage.
+  template <typename Functor>
+  typename std::enable_if<
+      std::is_class<typename std::decay<Functor>::type>::value>::type
+  Bind(Functor&& functor) {
+    BindTarget<false, CallbackTypeList<> >(std::forward<Functor>(functor));
+  }
+
+  // Same as NewPermanentCallback(object, member, pre_args...).
+  template <typename Result, typename Class, typename CallerClass,
+            typename... Params, typename... PreArgs>
+  void BindPermanent(Class* object, Result (CallerClass::*member)(Params...),
+                     PreArgs&&... pre_args) {
+    BindTarget<true, typename CallbackSignature<
+        Result, sizeof...(PreArgs), Params...>::PreParamList>(
+            InlineMemberFunctor<R, Class,
+                                Result (CallerClass::*)(Params...)>(
+                object, member),
+            std::forward<PreArgs>(pre_args)...);
+  }
+
+  // Same as NewPermanentCallback(const_object, const_member, pre_args...).
+  template <typename Result, typename Class, typename CallerClass,
+            typename... Params, typename... PreArgs>
+  void BindPermanent(const Class* object,
+                     Result (CallerClass::*member)(Params...) const,
+                     PreArgs&&... pre_args) {
+    BindTarget<true, typename CallbackSignature<
+        Result, sizeof...(PreArgs), Params...>::PreParamList>(
+            InlineMemberFunctor<R, const Class,
+                                Result (CallerClass::*)(Params...) const>(
+                object, member),
+            std::forward<PreArgs>(pre_args)...);
+  }
+
+  // Same as NewPermanentCallback(function, pre_args...).
+  template <typename Result, typename... Params, typename... PreArgs>
+  void BindPermanent(Result (*function)(Params...), PreArgs&&... pre_args) {
+    BindTarget<true, typename CallbackSignature<
+        Result, sizeof...(PreArgs), Params...>::PreParamList>(
+            InlineFunctionFunctor<R, Result (*)(Params...)>(function),
+            std::forward<PreArgs>(pre_args)...);
+  }
+
+  // Same as NewPermanentCallback(functor).
+  template <typename Functor>
+  typename std::enable_if<
+      std::is_class<typename std::decay<Functor>::type>::value>::type
+  BindPermanent(Functor&& functor) {
+    BindTarget<true, CallbackTypeList<> >(std::forward<Functor>(functor));
+  }
+
+  // Drops the bound target (and its pre-bound arguments) without running it.
+  void Reset() {
+    if (destroyer_ != NULL) {
+      destroyer_(&storage_);
+    }
+    runner_ = NULL;
+    destroyer_ = NULL;
+    repeatable_ = false;
+  }
+
+  bool IsBound() const { return runner_ != NULL; }
+
+  virtual bool IsRepeatable() const { return repeatable_; }
+
+  virtual R Run(Args... args) {
+    return runner_(this, std::forward<Args>(args)...);
+  }
+
+ private:
+  typedef R (*Runner)(InlineCallback* self, Args... args);
+  typedef void (*Destroyer)(void* storage);
+
+  template <bool Permanent, typename PreParamList, typename Functor,
+            typename... PreArgs>
+  void BindTarget(Functor&& functor, PreArgs&&... pre_args) {
+    typedef InlineCallbackBinder<
+        R, typename std::decay<Functor>::type, PreParamList,
+        CallbackTypeList<typename std::decay<PreArgs>::type...> > Binder;
+    static_assert(sizeof(Binder) <= kStorageSize,
+                  "bound target too big for InlineCallback storage");
+    static_assert(
+        std::alignment_of<Binder>::value <=
+            std::alignment_of<Storage>::value,
+        "bound target over-aligned for InlineCallback storage");
+    Reset();
+    new (&storage_) Binder(std::forward<Functor>(functor),
+                           std::forward<PreArgs>(pre_args)...);
+    runner_ = SelectRunner<Binder>(
+        std::integral_constant<bool, Permanent>());
+    destroyer_ = &Destroy<Binder>;
+    repeatable_ = Permanent;
+  }
+
+  // Only the runner actually used gets instantiated, so a permanent binding
+  // doesn't need movable pre-bound arguments and a one-shot one doesn't need
+  // copyable ones.
+  template <typename Binder>
+  static Runner SelectRunner(std::true_type /* permanent */) {
+    return &RunPermanent<Binder>;
+  }
+
+  template <typename Binder>
+  static Runner SelectRunner(std::false_type /* permanent */) {
+    return &RunOnce<Binder>;
+  }
+
+  template <typename Binder>
+  static R RunPermanent(InlineCallback* self, Args... args) {
+    Binder* binder = reinterpret_cast<Binder*>(&self->storage_);
+    return binder->template Run<false>(std::forward<Args>(args)...);
+  }
+
+  // Moves the target out of the storage and unbinds before calling it, the
+  // way NewCallback's object is gone once the target returns.  Pre-bound
+  // arguments are then moved on into the target, as by NewCallback.
+  template <typename Binder>
+  static R RunOnce(InlineCallback* self, Args... args) {
+    Binder* stored = reinterpret_cast<Binder*>(&self->storage_);
+    Binder binder(std::move(*stored));
+    stored->~Binder();
+    self->runner_ = NULL;
+    self->destroyer_ = NULL;
+    return binder.template Run<true>(std::forward<Args>(args)...);
+  }
+
+  template <typename Binder>
+  static void Destroy(void* storage) {
+    static_cast<Binder*>(storage)->~Binder();
+  }
+
+  typedef typename std::aligned_storage<kStorageSize>::type Storage;
+
+  Storage storage_;
+  Runner runner_;
+  Destroyer destroyer_;
+  bool repeatable_;
+
+  DISALLOW_COPY_AND_ASSIGN(InlineCallback);
+};
+
+#endif  // COMMON_BASE_INLINE_CALLBACK_H_
@@ -0,0 +1,235 @@
+#include "common/base/inline_callback.h"
+
+#include <memory>
+#include <string>
+#include "thirdparty/gtest/gtest.h"
+
+static int g_sum = 0;
+
+static void AddToSum(int a, int b) {
+  g_sum += a + b;
+}
+
+static int Multiply(int a, int b) {
+  return a * b;
+}
+
+class Counter {
+ public:
+  Counter() : count_(0) {}
+  void Add(int n) { count_ += n; }
+  int AddAndGet(int n, int m) {
+    count_ += n + m;
+    return count_;
+  }
+  int Get() const { return count_; }
+  int count() const { return count_; }
+ private:
+  int count_;
+};
+
+// Owns an InlineCallback and re-binds it from inside its own target.
+class Chain {
+ public:
+  explicit Chain(int steps) : steps_(steps), runs_(0) {}
+  Closure* Next() {
+    done_.Bind(this, &Chain::Step);
+    return &done_;
+  }
+  int runs() const { return runs_; }
+ private:
+  void Step() {
+    ++runs_;
+    if (runs_ < steps_) {
+      Next()->Run();
+    }
+  }
+  int steps_;
+  int runs_;
+  InlineCallback<void()> done_;
+};
+
+// Deletes itself, and with it the embedded callback, from inside the target.
+class SelfDeleter {
+ public:
+  explicit SelfDeleter(bool* deleted) : deleted_(deleted) {
+    done_.Bind(this, &SelfDeleter::Done, std::string("payload"));
+  }
+  Closure* done() { return &done_; }
+ private:
+  void Done(std::string payload) {
+    EXPECT_EQ("payload", payload);
+    *deleted_ = true;
+    delete this;
+  }
+  bool* deleted_;
+  InlineCallback<void(), 8 * sizeof(void*)> done_;
+};
+
+TEST(InlineCallbackTest, MemberCallback) {
+  Counter counter;
+  InlineCallback<void()> closure;
+  EXPECT_FALSE(closure.IsBound());
+  closure.Bind(&counter, &Counter::Add, 3);
+  EXPECT_TRUE(closure.IsBound());
+  EXPECT_FALSE(closure.IsRepeatable());
+  closure.Run();
+  EXPECT_EQ(3, counter.count());
+  EXPECT_FALSE(closure.IsBound());
+
+  InlineCallback<int(int)> callback;
+  callback.Bind(&counter, &Counter::AddAndGet, 1);
+  EXPECT_EQ(6, callback.Run(2));
+}
+
+TEST(InlineCallbackTest, ConstMemberCallback) {
+  Counter counter;
+  counter.Add(5);
+  const Counter* const_counter = &counter;
+  InlineCallback<int()> callback;
+  callback.Bind(const_counter, &Counter::Get);
+  EXPECT_EQ(5, callback.Run());
+}
+
+TEST(InlineCallbackTest, FunctionCallback) {
+  g_sum = 0;
+  InlineCallback<void(int)> callback;
+  callback.Bind(&AddToSum, 1);
+  callback.Run(2);
+  EXPECT_EQ(3, g_sum);
+
+  InlineCallback<int()> result;
+  result.Bind(&Multiply, 6, 7);
+  EXPECT_EQ(42, result.Run());
+}
+
+TEST(InlineCallbackTest, PermanentCallback) {
+  Counter counter;
+  InlineCallback<void(int)> callback;
+  callback.BindPermanent(&counter, &Counter::Add);
+  EXPECT_TRUE(callback.IsRepeatable());
+  callback.Run(1);
+  callback.Run(2);
+  EXPECT_TRUE(callback.IsBound());
+  EXPECT_EQ(3, counter.count());
+  callback.Reset();
+  EXPECT_FALSE(callback.IsBound());
+  EXPECT_FALSE(callback.IsRepeatable());
+}
+
+TEST(InlineCallbackTest, PassedAsClosure) {
+  Counter counter;
+  InlineCallback<void()> closure;
+  closure.Bind(&counter, &Counter::Add, 1);
+  Closure* done = &closure;
+  done->Run();
+  EXPECT_EQ(1, counter.count());
+  ::google::protobuf::Closure* pb_done = &closure;
+  closure.Bind(&counter, &Counter::Add, 2);
+  pb_done->Run();
+  EXPECT_EQ(3, counter.count());
+}
+
+TEST(InlineCallbackTest, RebindInsideRun) {
+  Chain chain(5);
+  chain.Next()->Run();
+  EXPECT_EQ(5, chain.runs());
+}
+
+TEST(InlineCallbackTest, DeleteOwnerInsideRun) {
+  bool deleted = false;
+  SelfDeleter* owner = new SelfDeleter(&deleted);
+  owner->done()->Run();
+  EXPECT_TRUE(deleted);
+}
+
+static void Consume(std::shared_ptr<int> value) {
+}
+
+TEST(InlineCallbackTest, ResetReleasesPreBoundArguments) {
+  std::shared_ptr<int> value(new int(1));
+  InlineCallback<void()> closure;
+  closure.Bind(&Consume, value);
+  EXPECT_EQ(2, value.use_count());
+  closure.Reset();
+  EXPECT_EQ(1, value.use_count());
+
+  closure.Bind(&Consume, value);
+  closure.Run();
+  EXPECT_EQ(1, value.use_count());
+}
+
+static int TakeOwnership(std::unique_ptr<int> value) {
+  return *value;
+}
+
+TEST(InlineCallbackTest, MoveOnlyPreBoundArgument) {
+  InlineCallback<int()> callback;
+  callback.Bind(&TakeOwnership, std::unique_ptr<int>(new int(42)));
+  EXPECT_EQ(42, callback.Run());
+  EXPECT_FALSE(callback.IsBound());
+}
+
+TEST(InlineCallbackTest, LambdaCallback) {
+  int count = 0;
+  InlineCallback<void()> closure;
+  closure.Bind([&count]() { ++count; });
+  closure.Run();
+  EXPECT_EQ(1, count);
+  EXPECT_FALSE(closure.IsBound());
+
+  InlineCallback<int(int)> callback;
+  int base = 40;
+  callback.BindPermanent([base](int a) { return base + a; });
+  EXPECT_EQ(41, callback.Run(1));
+  EXPECT_EQ(42, callback.Run(2));
+}
+
+class NamedBase {
+ public:
+  virtual ~NamedBase() {}
+  virtual std::string Name() const { return "Base"; }
+};
+
+class NamedDerived : public NamedBase {
+ public:
+  virtual std::string Name() const { return "Derived"; }
+};
+
+class AbstractShape {
+ public:
+  virtual ~AbstractShape() {}
+  virtual std::string Name() const = 0;
+};
+
+class Square : public AbstractShape {
+ public:
+  virtual std::string Name() const { return "Square"; }
+};
+
+static std::string NameOf(const NamedBase& object) {
+  return object.Name();
+}
+
+static std::string ShapeNameOf(const AbstractShape& shape) {
+  return shape.Name();
+}
+
+TEST(InlineCallbackTest, DerivedArgumentIsNotSliced) {
+  // Stored as the argument's type, not the parameter's.
+  NamedDerived derived;
+  InlineCallback<std::string()> callback;
+  callback.Bind(&NameOf, derived);
+  EXPECT_EQ("Derived", callback.Run());
+  callback.BindPermanent(&NameOf, derived);
+  EXPECT_EQ("Derived", callback.Run());
+  EXPECT_EQ("Derived", callback.Run());
+}
+
+TEST(InlineCallbackTest, AbstractBaseReferenceParameter) {
+  InlineCallback<std::string()> callback;
+  callback.Bind(&ShapeNameOf, Square());
+  EXPECT_EQ("Square", callback.Run());
+  callback.BindPermanent(&ShapeNameOf, Square());
+  EXPECT_EQ("Square", callback.Run());
+}
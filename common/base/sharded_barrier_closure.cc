@@ -0,0 +1,94 @@
+#include "common/base/sharded_barrier_closure.h"
+
+#include <stdlib.h>
+#include <algorithm>
+#include <new>
+#include <thread>
+#include "thirdparty/glog/logging.h"
+
+namespace {
+
+std::atomic<int> g_next_shard_hint(0);
+__thread int t_shard_hint = -1;
+
+int ShardHint() {
+  if (t_shard_hint < 0) {
+    t_shard_hint = g_next_shard_hint.fetch_add(1, std::memory_order_relaxed) &
+                   0x7fffffff;
+  }
+  return t_shard_hint;
+}
+
+}  // namespace
+
+ShardedBarrierClosure::ShardedBarrierClosure(int n, Closure* done,
+                                             int shards)
+    : shard_num_(shards), done_(done) {
+  CHECK_GT(n, 0);
+  if (shard_num_ <= 0) {
+    shard_num_ = std::max(1u, std::thread::hardware_concurrency());
+  }
+  // Every shard must get at least one arrival to complete.
+  shard_num_ = std::min(shard_num_, n);
+
+  int node_num = shard_num_;
+  for (int size = shard_num_; size > 1; ) {
+    size = (size + kFanIn - 1) / kFanIn;
+    node_num += size;
+  }
+  void* memory = NULL;
+  CHECK_EQ(0, posix_memalign(&memory, alignof(Node), node_num * sizeof(Node)));
+  nodes_.reset(static_cast<Node*>(memory));
+  for (int i = 0; i < node_num; ++i) {
+    new (&nodes_[i]) Node;
+  }
+
+  for (int i = 0; i < shard_num_; ++i) {
+    nodes_[i].left.store(n / shard_num_ + (i < n % shard_num_ ? 1 : 0),
+                         std::memory_order_relaxed);
+  }
+  int level_begin = 0;
+  int level_size = shard_num_;
+  while (level_size > 1) {
+    const int parent_begin = level_begin + level_size;
+    const int parent_size = (level_size + kFanIn - 1) / kFanIn;
+    for (int i = 0; i < level_size; ++i) {
+      nodes_[level_begin + i].parent = parent_begin + i / kFanIn;
+    }
+    for (int i = 0; i < parent_size; ++i) {
+      nodes_[parent_begin + i].left.store(
+          std::min(kFanIn, level_size - i * kFanIn),
+          std::memory_order_relaxed);
+    }
+    level_begin = parent_begin;
+    level_size = parent_size;
+  }
+  nodes_[level_begin].parent = -1;
+}
+
+void ShardedBarrierClosure::FreeNodes::operator()(Node* nodes) const {
+  // Nodes are trivially destructible.
+  free(nodes);
+}
+
+void ShardedBarrierClosure::Run() {
+  // Shards which are used up go negative; whoever takes the last arrival
+  // of a shard, seeing 1, completes it.
+  int shard = ShardHint() % shard_num_;
+  int left;
+  while ((left = nodes_[shard].left.fetch_sub(
+              1, std::memory_order_acq_rel)) <= 0) {
+    shard = shard + 1 < shard_num_ ? shard + 1 : 0;
+  }
+  if (left != 1) {
+    return;
+  }
+  for (int node = nodes_[shard].parent; node >= 0;
+       node = nodes_[node].parent) {
+    if (nodes_[node].left.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+      return;
+    }
+  }
+  done_->Run();
+  delete this;
+}
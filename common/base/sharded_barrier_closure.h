@@ -0,0 +1,61 @@
+#ifndef COMMON_BASE_SHARDED_BARRIER_CLOSURE_H_
+#define COMMON_BASE_SHARDED_BARRIER_CLOSURE_H_
+
+#include <atomic>
+#include <memory>
+#include "common/base/callback.h"
+
+// A BarrierClosure for very wide fan-in: runs done after n Run()s, but the
+// count is split over shards, each on its own cache line, combined by a
+// tree.  An arrival decrements the shard of its thread; only the last
+// arrival of a shard goes on to the node above it, and so on up to the
+// root.  So the threads hammering one barrier mostly touch different
+// lines, and the root line is touched once per kFanIn shards below it.
+//
+// A shard gets n / shards of the arrivals; a thread whose shard is used up
+// moves on to the next one.  Threads are spread over shards round robin,
+// in the order they first arrive at any ShardedBarrierClosure.
+//
+// Worth it only with many threads arriving at once: an arrival costs about
+// the same as BarrierClosure's uncontended, plus the walk up the tree for
+// the last one of each shard.  Like BarrierClosure it deletes itself after
+// done has run.
+class ShardedBarrierClosure : public Closure {
+ public:
+  static const int kFanIn = 8;
+
+  // shards <= 0 picks one per hardware thread.
+  ShardedBarrierClosure(int n, Closure* done, int shards = 0);
+
+  virtual bool IsRepeatable() const {
+    return false;
+  }
+
+  virtual void Run();
+
+ private:
+  // One cache line each, so the counters of different nodes don't share one.
+  struct alignas(64) Node {
+    std::atomic<int> left;
+    int parent;
+  };
+  static_assert(sizeof(Node) == 64 && alignof(Node) == 64,
+                "a Node must take exactly one cache line");
+
+  // new[] doesn't honor Node's alignment before C++17, so the nodes come
+  // from posix_memalign().
+  struct FreeNodes {
+    void operator()(Node* nodes) const;
+  };
+
+  ~ShardedBarrierClosure() {}
+
+  // Level by level from the leaves, nodes_[0, shard_num_), to the root.
+  std::unique_ptr<Node[], FreeNodes> nodes_;
+  int shard_num_;
+  Closure* done_;
+
+  DISALLOW_COPY_AND_ASSIGN(ShardedBarrierClosure);
+};
+
+#endif  // COMMON_BASE_SHARDED_BARRIER_CLOSURE_H_
@@ -0,0 +1,70 @@
+#include "common/base/sharded_barrier_closure.h"
+
+#include <thread>
+#include <vector>
+#include "thirdparty/gtest/gtest.h"
+
+static void DoInc(int* i) {
+  ++*i;
+}
+
+TEST(ShardedBarrierClosureTest, SimpleTest) {
+  int i = 0;
+  Closure* barrier = new ShardedBarrierClosure(3, NewCallback(&DoInc, &i), 2);
+  barrier->Run();
+  barrier->Run();
+  EXPECT_EQ(0, i);
+  barrier->Run();
+  EXPECT_EQ(1, i);
+}
+
+TEST(ShardedBarrierClosureTest, MoreShardsThanArrivals) {
+  int i = 0;
+  Closure* barrier = new ShardedBarrierClosure(2, NewCallback(&DoInc, &i), 64);
+  barrier->Run();
+  EXPECT_EQ(0, i);
+  barrier->Run();
+  EXPECT_EQ(1, i);
+}
+
+// Enough shards for a three level tree; one thread takes every shard's
+// arrivals, moving on as each is used up.
+TEST(ShardedBarrierClosureTest, DeepTree) {
+  const int kShards = ShardedBarrierClosure::kFanIn *
+                      ShardedBarrierClosure::kFanIn + 3;
+  for (int n = kShards; n < kShards * 3; n += 17) {
+    int i = 0;
+    Closure* barrier =
+        new ShardedBarrierClosure(n, NewCallback(&DoInc, &i), kShards);
+    for (int k = 0; k < n - 1; ++k) {
+      barrier->Run();
+    }
+    EXPECT_EQ(0, i);
+    barrier->Run();
+    EXPECT_EQ(1, i);
+  }
+}
+
+static void RunTimes(Closure* barrier, int times) {
+  for (int k = 0; k < times; ++k) {
+    barrier->Run();
+  }
+}
+
+TEST(ShardedBarrierClosureTest, MultipleThreadTest) {
+  int i = 0;
+  const int kThreadNum = 1000;
+  const int kRunsPerThread = 7;
+  Closure* barrier = new ShardedBarrierClosure(
+      kThreadNum * kRunsPerThread + 1, NewCallback(&DoInc, &i), 16);
+  std::vector<std::thread> threads;
+  for (int k = 0; k < kThreadNum; ++k) {
+    threads.push_back(std::thread(&RunTimes, barrier, kRunsPerThread));
+  }
+  for (int k = 0; k < kThreadNum; ++k) {
+    threads[k].join();
+  }
+  EXPECT_EQ(0, i);
+  barrier->Run();
+  EXPECT_EQ(1, i);
+}
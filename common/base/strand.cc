@@ -0,0 +1,63 @@
+#include "common/base/strand.h"
+
+#include <thread>
+#include "thirdparty/glog/logging.h"
+
+__thread Strand* Strand::current_ = NULL;
+
+Strand::Strand(Executor* executor)
+    : executor_(executor), size_(0), drain_task_(this) {
+}
+
+Strand::~Strand() {
+  CHECK_EQ(0, size_.load(std::memory_order_acquire))
+      << "Strand destroyed with tasks pending";
+}
+
+void Strand::AddTask(Closure* task) {
+  queue_.Push(task);
+  if (size_.fetch_add(1, std::memory_order_acq_rel) == 0) {
+    executor_->AddTask(&drain_task_);
+  }
+}
+
+void Strand::AddTasks(Closure* head) {
+  Closure* tail = head;
+  int64_t count = 1;
+  while (tail->next_closure != NULL) {
+    tail = tail->next_closure;
+    ++count;
+  }
+  queue_.PushChain(head, tail);
+  if (size_.fetch_add(count, std::memory_order_acq_rel) == 0) {
+    executor_->AddTask(&drain_task_);
+  }
+}
+
+bool Strand::RunningInThisThread() const {
+  return current_ == this;
+}
+
+void Strand::Drain() {
+  Strand* outer = current_;
+  current_ = this;
+  for (int count = 1; ; ++count) {
+    Closure* task;
+    // The task counted in size_ may still be on its way into the queue.
+    while ((task = queue_.Pop()) == NULL) {
+      std::this_thread::yield();
+    }
+    task->Run();
+    if (size_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      // Whoever adds the next task posts a new drain; this strand may even
+      // be gone already.
+      current_ = outer;
+      return;
+    }
+    if (count == kMaxTasksPerDrain) {
+      current_ = outer;
+      executor_->AddTask(&drain_task_);
+      return;
+    }
+  }
+}
@@ -0,0 +1,66 @@
+#ifndef COMMON_BASE_STRAND_H_
+#define COMMON_BASE_STRAND_H_
+
+#include <stdint.h>
+#include <atomic>
+#include "common/base/callback.h"
+#include "common/base/closure_queue.h"
+#include "common/base/executor.h"
+
+// A Strand is a serial Executor on top of another one (usually a
+// ThreadPool): tasks added to the same strand run one at a time, in the
+// order they were added, though not necessarily on the same thread; tasks
+// of different strands still run in parallel.  Whatever only a strand's
+// tasks touch needs no lock:
+//
+//   Strand strand(&pool);
+//   // any thread, e.g. each completing a different call
+//   strand.AddTask(NewCallback(this, &Merger::AddResults, response));
+//
+// A strand is no thread and holds no mutex.  Added tasks go onto a
+// lock-free ClosureQueue, and a count of queued tasks decides who runs
+// them: the AddTask() taking it from 0 posts the strand's drain task to the
+// underlying executor, and that drain task runs queued tasks until the
+// count is back to 0.  After kMaxTasksPerDrain tasks it re-posts itself
+// instead, so that a busy strand doesn't hog a worker.
+class Strand : public Executor {
+ public:
+  // executor must outlive the strand.
+  explicit Strand(Executor* executor);
+
+  // There must be no task queued or running.
+  virtual ~Strand();
+
+  // Any thread.  A task added by a task of this strand runs after it.
+  virtual void AddTask(Closure* task);
+  virtual void AddTasks(Closure* head);
+
+  // True if called from a task of this strand.
+  bool RunningInThisThread() const;
+
+  static const int kMaxTasksPerDrain = 64;
+
+ private:
+  class DrainTask : public Closure {
+   public:
+    explicit DrainTask(Strand* strand) : strand_(strand) {}
+    virtual bool IsRepeatable() const { return true; }
+    virtual void Run() { strand_->Drain(); }
+   private:
+    Strand* strand_;
+  };
+
+  void Drain();
+
+  static __thread Strand* current_;
+
+  Executor* executor_;
+  ClosureQueue queue_;
+  // Tasks added and not run yet.
+  std::atomic<int64_t> size_;
+  DrainTask drain_task_;
+
+  DISALLOW_COPY_AND_ASSIGN(Strand);
+};
+
+#endif  // COMMON_BASE_STRAND_H_
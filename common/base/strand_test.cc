@@ -0,0 +1,156 @@
+#include "common/base/strand.h"
+
+#include <atomic>
+#include <vector>
+#include "common/base/thread_pool.h"
+#include "thirdparty/gtest/gtest.h"
+
+// Records the order tasks run in, and whether two ever overlapped.  Only the
+// strand serializes access to order_.
+class SerialChecker {
+ public:
+  SerialChecker() : running_(0), overlapped_(false) {}
+
+  void Record(int value) {
+    if (running_.fetch_add(1) != 0) {
+      overlapped_ = true;
+    }
+    order_.push_back(value);
+    running_.fetch_sub(1);
+  }
+
+  const std::vector<int>& order() const { return order_; }
+  bool overlapped() const { return overlapped_.load(); }
+
+ private:
+  std::atomic<int> running_;
+  std::atomic<bool> overlapped_;
+  std::vector<int> order_;
+};
+
+TEST(StrandTest, RunsInOrderWithoutOverlap) {
+  ThreadPool pool(4);
+  Strand strand(&pool);
+  SerialChecker checker;
+  const int kTaskNum = 10000;
+  for (int i = 0; i < kTaskNum; ++i) {
+    strand.AddTask(NewCallback(&checker, &SerialChecker::Record, i));
+  }
+  pool.WaitForIdle();
+  EXPECT_FALSE(checker.overlapped());
+  ASSERT_EQ(static_cast<size_t>(kTaskNum), checker.order().size());
+  for (int i = 0; i < kTaskNum; ++i) {
+    EXPECT_EQ(i, checker.order()[i]);
+  }
+}
+
+static void AddTasks(Strand* strand, SerialChecker* checker, int base,
+                     int count) {
+  for (int i = 0; i < count; ++i) {
+    strand->AddTask(NewCallback(checker, &SerialChecker::Record, base + i));
+  }
+}
+
+// Tasks from each producer keep their order; all of them are serialized.
+TEST(StrandTest, ConcurrentProducers) {
+  ThreadPool pool(4);
+  Strand strand(&pool);
+  SerialChecker checker;
+  const int kThreadNum = 4;
+  const int kTaskNum = 20000;
+  std::vector<shared_ptr<Thread> > threads(kThreadNum);
+  for (int t = 0; t < kThreadNum; ++t) {
+    threads[t].reset(new Thread(NewCallback(
+        &AddTasks, &strand, &checker, t * kTaskNum, kTaskNum)));
+    threads[t]->Start();
+  }
+  for (int t = 0; t < kThreadNum; ++t) {
+    threads[t]->Join();
+  }
+  pool.WaitForIdle();
+  EXPECT_FALSE(checker.overlapped());
+  ASSERT_EQ(static_cast<size_t>(kThreadNum * kTaskNum),
+            checker.order().size());
+  std::vector<int> last(kThreadNum, -1);
+  for (size_t i = 0; i < checker.order().size(); ++i) {
+    int value = checker.order()[i];
+    EXPECT_LT(last[value / kTaskNum], value);
+    last[value / kTaskNum] = value;
+  }
+}
+
+static void AddFromTask(Strand* strand, std::vector<int>* order, int depth) {
+  EXPECT_TRUE(strand->RunningInThisThread());
+  order->push_back(depth);
+  if (depth < 3) {
+    strand->AddTask(NewCallback(&AddFromTask, strand, order, depth + 1));
+    order->push_back(-depth);
+  }
+}
+
+// A task added from inside the strand runs after the current one, even on
+// an InlineExecutor.
+TEST(StrandTest, AddFromTask) {
+  InlineExecutor executor;
+  Strand strand(&executor);
+  std::vector<int> order;
+  EXPECT_FALSE(strand.RunningInThisThread());
+  strand.AddTask(NewCallback(&AddFromTask, &strand, &order, 0));
+  EXPECT_FALSE(strand.RunningInThisThread());
+  int expected[] = { 0, 0, 1, -1, 2, -2, 3 };
+  ASSERT_EQ(sizeof(expected) / sizeof(expected[0]), order.size());
+  for (size_t i = 0; i < order.size(); ++i) {
+    EXPECT_EQ(expected[i], order[i]);
+  }
+}
+
+TEST(StrandTest, AddTasks) {
+  ThreadPool pool(4);
+  Strand strand(&pool);
+  SerialChecker checker;
+  const int kChainNum = 100;
+  const int kChainLength = 10;
+  for (int c = 0; c < kChainNum; ++c) {
+    Closure* head = NULL;
+    for (int i = kChainLength - 1; i >= 0; --i) {
+      Closure* task = NewCallback(&checker, &SerialChecker::Record,
+                                  c * kChainLength + i);
+      task->next_closure = head;
+      head = task;
+    }
+    strand.AddTasks(head);
+  }
+  pool.WaitForIdle();
+  EXPECT_FALSE(checker.overlapped());
+  ASSERT_EQ(static_cast<size_t>(kChainNum * kChainLength),
+            checker.order().size());
+  for (int i = 0; i < kChainNum * kChainLength; ++i) {
+    EXPECT_EQ(i, checker.order()[i]);
+  }
+}
+
+static void Count(int* count) {
+  ++*count;
+}
+
+// More than kMaxTasksPerDrain tasks take several drains; each strand's own
+// counter needs no lock.
+TEST(StrandTest, ManyStrands) {
+  ThreadPool pool(4);
+  const int kStrandNum = 8;
+  const int kTaskNum = Strand::kMaxTasksPerDrain * 10;
+  std::vector<shared_ptr<Strand> > strands(kStrandNum);
+  std::vector<int> counts(kStrandNum, 0);
+  for (int s = 0; s < kStrandNum; ++s) {
+    strands[s].reset(new Strand(&pool));
+  }
+  for (int i = 0; i < kTaskNum; ++i) {
+    for (int s = 0; s < kStrandNum; ++s) {
+      strands[s]->AddTask(NewCallback(&Count, &counts[s]));
+    }
+  }
+  pool.WaitForIdle();
+  for (int s = 0; s < kStrandNum; ++s) {
+    EXPECT_EQ(kTaskNum, counts[s]);
+  }
+}
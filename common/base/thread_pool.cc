@@ -0,0 +1,313 @@
+#include "common/base/thread_pool.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <thread>
+
+namespace {
+
+// Tasks moved from ThreadPool::injected_ to a worker's deque at a time.
+const size_t kInjectedBatchSize = 32;
+
+// Chase-Lev work-stealing deque, with the C11 memory orders from "Correct
+// and Efficient Work-Stealing for Weak Memory Models" (Le et al., 2013).
+// The owner pushes and pops at the bottom; thieves steal from the top.
+class WorkStealingDeque {
+ public:
+  WorkStealingDeque() : top_(0), bottom_(0), array_(new Array(64)) {}
+
+  ~WorkStealingDeque() {
+    delete array_.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < retired_.size(); ++i) {
+      delete retired_[i];
+    }
+  }
+
+  // Owner only.
+  void Push(Closure* task) {
+    int64_t bottom = bottom_.load(std::memory_order_relaxed);
+    int64_t top = top_.load(std::memory_order_acquire);
+    Array* array = array_.load(std::memory_order_relaxed);
+    if (bottom - top >= array->capacity()) {
+      array = Grow(array, top, bottom);
+    }
+    array->Put(bottom, task);
+    bottom_.store(bottom + 1, std::memory_order_release);
+  }
+
+  // Owner only.  Returns the most recently pushed task, or NULL.
+  Closure* Pop() {
+    int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+    Array* array = array_.load(std::memory_order_relaxed);
+    bottom_.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t top = top_.load(std::memory_order_relaxed);
+    if (top > bottom) {
+      bottom_.store(bottom + 1, std::memory_order_relaxed);
+      return NULL;
+    }
+    Closure* task = array->Get(bottom);
+    if (top == bottom) {
+      // The last task; a thief may be taking it too.
+      if (!top_.compare_exchange_strong(top, top + 1,
+                                        std::memory_order_seq_cst,
+                                        std::memory_order_relaxed)) {
+        task = NULL;
+      }
+      bottom_.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return task;
+  }
+
+  // Any thread.  Returns the oldest task, or NULL if the deque is empty or
+  // another thread took it first.
+  Closure* Steal() {
+    int64_t top = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t bottom = bottom_.load(std::memory_order_acquire);
+    if (top >= bottom) {
+      return NULL;
+    }
+    Array* array = array_.load(std::memory_order_acquire);
+    Closure* task = array->Get(top);
+    if (!top_.compare_exchange_strong(top, top + 1,
+                                      std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+      return NULL;
+    }
+    return task;
+  }
+
+ private:
+  class Array {
+   public:
+    explicit Array(int64_t capacity)
+        : capacity_(capacity), slots_(new std::atomic<Closure*>[capacity]) {}
+    ~Array() { delete[] slots_; }
+
+    int64_t capacity() const { return capacity_; }
+
+    Closure* Get(int64_t index) const {
+      return slots_[index & (capacity_ - 1)].load(std::memory_order_relaxed);
+    }
+    void Put(int64_t index, Closure* task) {
+      slots_[index & (capacity_ - 1)].store(task, std::memory_order_relaxed);
+    }
+
+   private:
+    int64_t capacity_;
+    std::atomic<Closure*>* slots_;
+  };
+
+  Array* Grow(Array* array, int64_t top, int64_t bottom) {
+    Array* bigger = new Array(array->capacity() * 2);
+    for (int64_t i = top; i < bottom; ++i) {
+      bigger->Put(i, array->Get(i));
+    }
+    // Thieves may still be reading the old array, so it lives as long as
+    // the deque.
+    retired_.push_back(array);
+    array_.store(bigger, std::memory_order_release);
+    return bigger;
+  }
+
+  alignas(64) std::atomic<int64_t> top_;
+  alignas(64) std::atomic<int64_t> bottom_;
+  std::atomic<Array*> array_;
+  std::vector<Array*> retired_;
+};
+
+}  // namespace
+
+struct ThreadPool::Worker {
+  Worker(ThreadPool* owner, uint32_t seed) : pool(owner), random(seed) {}
+
+  ThreadPool* pool;
+  WorkStealingDeque deque;
+  // xorshift state for picking steal victims.
+  uint32_t random;
+  std::thread thread;
+};
+
+__thread ThreadPool::Worker* ThreadPool::current_worker_ = NULL;
+
+ThreadPool::ThreadPool(int num_workers, bool pin_workers)
+    : pending_(0), unfinished_(0), sleeping_(0), stopping_(false) {
+  std::vector<int> cpus;
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  if (sched_getaffinity(0, sizeof(allowed), &allowed) == 0) {
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+      if (CPU_ISSET(cpu, &allowed)) {
+        cpus.push_back(cpu);
+      }
+    }
+  }
+  if (num_workers <= 0) {
+    num_workers = cpus.empty() ? 1 : static_cast<int>(cpus.size());
+  }
+  // All workers exist before any of them starts stealing.
+  for (int i = 0; i < num_workers; ++i) {
+    workers_.push_back(new Worker(this, 2654435761u * (i + 1)));
+  }
+  for (int i = 0; i < num_workers; ++i) {
+    int cpu = (pin_workers && !cpus.empty()) ? cpus[i % cpus.size()] : -1;
+    workers_[i]->thread =
+        std::thread(&ThreadPool::WorkerMain, this, workers_[i], cpu);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  WaitForIdle();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  wake_.notify_all();
+  // Workers may steal from each other until they have all stopped.
+  for (size_t i = 0; i < workers_.size(); ++i) {
+    workers_[i]->thread.join();
+  }
+  for (size_t i = 0; i < workers_.size(); ++i) {
+    delete workers_[i];
+  }
+}
+
+void ThreadPool::AddTask(Closure* task) {
+  unfinished_.fetch_add(1, std::memory_order_relaxed);
+  Worker* worker = current_worker_;
+  if (worker != NULL && worker->pool == this) {
+    worker->deque.Push(task);
+  } else {
+    injected_.Push(task);
+  }
+  WakeWorkers(1);
+}
+
+void ThreadPool::AddTasks(Closure* head) {
+  Worker* worker = current_worker_;
+  if (worker != NULL && worker->pool == this) {
+    Executor::AddTasks(head);
+    return;
+  }
+  Closure* tail = head;
+  int64_t count = 1;
+  while (tail->next_closure != NULL) {
+    tail = tail->next_closure;
+    ++count;
+  }
+  unfinished_.fetch_add(count, std::memory_order_relaxed);
+  injected_.PushChain(head, tail);
+  WakeWorkers(count);
+}
+
+void ThreadPool::WakeWorkers(int64_t count) {
+  // Pairs with the sleeping_ increment in WorkerMain: either a worker sees
+  // the tasks, or we see the worker and wake it.
+  pending_.fetch_add(count, std::memory_order_seq_cst);
+  if (sleeping_.load(std::memory_order_seq_cst) > 0) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (count == 1) {
+      wake_.notify_one();
+    } else {
+      wake_.notify_all();
+    }
+  }
+}
+
+void ThreadPool::WaitForIdle() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (unfinished_.load(std::memory_order_acquire) != 0) {
+    idle_.wait(lock);
+  }
+}
+
+bool ThreadPool::IsWorkerThread() const {
+  return current_worker_ != NULL && current_worker_->pool == this;
+}
+
+void ThreadPool::WorkerMain(Worker* worker, int cpu) {
+  if (cpu >= 0) {
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(cpu, &cpu_set);
+    pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+  }
+  current_worker_ = worker;
+  for (;;) {
+    Closure* task = FindTask(worker);
+    if (task != NULL) {
+      pending_.fetch_sub(1, std::memory_order_relaxed);
+      task->Run();
+      if (unfinished_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        idle_.notify_all();
+      }
+      continue;
+    }
+    if (pending_.load(std::memory_order_seq_cst) > 0) {
+      // Lost a race for the task, or its producer is still pushing it.
+      std::this_thread::yield();
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    sleeping_.fetch_add(1, std::memory_order_seq_cst);
+    while (pending_.load(std::memory_order_seq_cst) == 0 && !stopping_) {
+      wake_.wait(lock);
+    }
+    sleeping_.fetch_sub(1, std::memory_order_relaxed);
+    if (stopping_ && pending_.load(std::memory_order_relaxed) == 0) {
+      break;
+    }
+  }
+  current_worker_ = NULL;
+}
+
+Closure* ThreadPool::FindTask(Worker* worker) {
+  Closure* task = worker->deque.Pop();
+  if (task == NULL) {
+    task = TakeInjectedTasks(worker);
+  }
+  if (task == NULL) {
+    task = StealTask(worker);
+  }
+  return task;
+}
+
+Closure* ThreadPool::TakeInjectedTasks(Worker* worker) {
+  if (!injected_mutex_.try_lock()) {
+    return NULL;
+  }
+  Closure* batch[kInjectedBatchSize];
+  size_t count = injected_.PopBatch(batch, kInjectedBatchSize);
+  injected_mutex_.unlock();
+  if (count == 0) {
+    return NULL;
+  }
+  // Run the first one now; the rest go to the deque where other workers
+  // can steal them.  Pushed newest first so the owner still pops them in
+  // the order they were added.
+  for (size_t i = count - 1; i > 0; --i) {
+    worker->deque.Push(batch[i]);
+  }
+  return batch[0];
+}
+
+Closure* ThreadPool::StealTask(Worker* worker) {
+  size_t num_workers = workers_.size();
+  worker->random ^= worker->random << 13;
+  worker->random ^= worker->random >> 17;
+  worker->random ^= worker->random << 5;
+  size_t start = worker->random % num_workers;
+  for (size_t i = 0; i < num_workers; ++i) {
+    Worker* victim = workers_[(start + i) % num_workers];
+    if (victim == worker) {
+      continue;
+    }
+    Closure* task = victim->deque.Steal();
+    if (task != NULL) {
+      return task;
+    }
+  }
+  return NULL;
+}
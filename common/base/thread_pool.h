@@ -0,0 +1,86 @@
+#ifndef COMMON_BASE_THREAD_POOL_H_
+#define COMMON_BASE_THREAD_POOL_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+#include "common/base/callback.h"
+#include "common/base/closure_queue.h"
+#include "common/base/executor.h"
+
+// ThreadPool runs Closures on a fixed set of worker threads.  Any Closure
+// can be a task: a NewCallback() one deletes itself after running, a
+// NewPermanentCallback() or InlineCallback one stays owned by the caller.
+//
+//   ThreadPool pool(8);
+//   pool.AddTask(NewCallback(this, &Indexer::BuildShard, shard));
+//   pool.AddTask(NewCallback([&counter]() { ++counter; }));
+//   pool.WaitForIdle();
+//
+// Each worker owns a Chase-Lev work-stealing deque.  Tasks added from a
+// worker go to the bottom of its own deque and it runs them LIFO, so a task
+// which fans out keeps its children on the CPU whose cache already holds
+// their data; idle workers steal from the top of the others' deques.  Tasks
+// added from other threads go through a lock-free ClosureQueue which idle
+// workers drain in batches.
+//
+// A permanent closure must not be added again before it starts running.
+class ThreadPool : public Executor {
+ public:
+  // num_workers <= 0 means one worker per CPU this process may run on.  If
+  // pin_workers is true, worker i is bound to the i-th such CPU.
+  explicit ThreadPool(int num_workers = 0, bool pin_workers = false);
+
+  // Waits for all tasks, including the ones added by running tasks, then
+  // stops the workers.
+  ~ThreadPool();
+
+  // Any thread.
+  virtual void AddTask(Closure* task);
+  // Any thread.  The tasks still run in parallel; from a non-worker thread
+  // the chain is injected with one queue operation.
+  virtual void AddTasks(Closure* head);
+
+  // Blocks until every task added so far, and every task they added, has
+  // run.  Must not be called from a worker of this pool.
+  void WaitForIdle();
+
+  // True if the calling thread is one of this pool's workers.
+  bool IsWorkerThread() const;
+
+  int num_workers() const {
+    return static_cast<int>(workers_.size());
+  }
+
+ private:
+  struct Worker;
+
+  void WorkerMain(Worker* worker, int cpu);
+  Closure* FindTask(Worker* worker);
+  Closure* TakeInjectedTasks(Worker* worker);
+  Closure* StealTask(Worker* worker);
+  void WakeWorkers(int64_t count);
+
+  static __thread Worker* current_worker_;
+
+  std::vector<Worker*> workers_;
+  // Tasks from non-worker threads.  Producers are lock-free; the workers
+  // take turns consuming under injected_mutex_.
+  ClosureQueue injected_;
+  std::mutex injected_mutex_;
+  // Tasks added but not taken by a worker yet.
+  std::atomic<int64_t> pending_;
+  // Tasks added but not finished yet.
+  std::atomic<int64_t> unfinished_;
+  std::atomic<int> sleeping_;
+  bool stopping_;
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::condition_variable idle_;
+
+  DISALLOW_COPY_AND_ASSIGN(ThreadPool);
+};
+
+#endif  // COMMON_BASE_THREAD_POOL_H_
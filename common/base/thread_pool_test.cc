@@ -0,0 +1,181 @@
+#include "common/base/thread_pool.h"
+
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <thread>
+#include "thirdparty/gtest/gtest.h"
+
+static void Inc(std::atomic<int>* count) {
+  count->fetch_add(1);
+}
+
+TEST(ThreadPoolTest, RunsAllTasks) {
+  ThreadPool pool(4);
+  EXPECT_EQ(4, pool.num_workers());
+  std::atomic<int> count(0);
+  for (int i = 0; i < 10000; ++i) {
+    pool.AddTask(NewCallback(&Inc, &count));
+  }
+  pool.WaitForIdle();
+  EXPECT_EQ(10000, count.load());
+}
+
+TEST(ThreadPoolTest, DefaultsToOneWorkerPerCpu) {
+  ThreadPool pool;
+  EXPECT_GE(pool.num_workers(), 1);
+}
+
+TEST(ThreadPoolTest, DestructorRunsPendingTasks) {
+  std::atomic<int> count(0);
+  {
+    ThreadPool pool(2);
+    for (int i = 0; i < 1000; ++i) {
+      pool.AddTask(NewCallback(&Inc, &count));
+    }
+  }
+  EXPECT_EQ(1000, count.load());
+}
+
+TEST(ThreadPoolTest, PermanentClosure) {
+  ThreadPool pool(2);
+  std::atomic<int> count(0);
+  Closure* closure = NewPermanentCallback(&Inc, &count);
+  for (int i = 0; i < 10; ++i) {
+    pool.AddTask(closure);
+    pool.WaitForIdle();
+  }
+  EXPECT_EQ(10, count.load());
+  delete closure;
+}
+
+static void FanOut(ThreadPool* pool, std::atomic<int>* count, int depth) {
+  count->fetch_add(1);
+  if (depth > 0) {
+    pool->AddTask(NewCallback(&FanOut, pool, count, depth - 1));
+    pool->AddTask(NewCallback(&FanOut, pool, count, depth - 1));
+  }
+}
+
+// WaitForIdle() also waits for the tasks added by tasks.
+TEST(ThreadPoolTest, TasksAddingTasks) {
+  ThreadPool pool(4);
+  std::atomic<int> count(0);
+  pool.AddTask(NewCallback(&FanOut, &pool, &count, 12));
+  pool.WaitForIdle();
+  EXPECT_EQ((1 << 13) - 1, count.load());
+}
+
+TEST(ThreadPoolTest, IsWorkerThread) {
+  ThreadPool pool(2);
+  ThreadPool other(1);
+  EXPECT_FALSE(pool.IsWorkerThread());
+  std::atomic<int> in_pool(0);
+  std::atomic<int> in_other(0);
+  pool.AddTask(NewCallback([&]() {
+    in_pool = pool.IsWorkerThread();
+    in_other = other.IsWorkerThread();
+  }));
+  pool.WaitForIdle();
+  EXPECT_EQ(1, in_pool.load());
+  EXPECT_EQ(0, in_other.load());
+}
+
+// The children stay on the spawning worker's deque while it blocks, so the
+// other workers can only get them by stealing.
+TEST(ThreadPoolTest, IdleWorkersSteal) {
+  const int kChildNum = 100;
+  ThreadPool pool(4);
+  std::atomic<int> count(0);
+  std::mutex mutex;
+  std::set<std::thread::id> runners;
+  std::thread::id spawner;
+  pool.AddTask(NewCallback([&]() {
+    spawner = std::this_thread::get_id();
+    for (int i = 0; i < kChildNum; ++i) {
+      pool.AddTask(NewCallback([&]() {
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          runners.insert(std::this_thread::get_id());
+        }
+        count.fetch_add(1);
+      }));
+    }
+    while (count.load() < kChildNum) {
+      std::this_thread::yield();
+    }
+  }));
+  pool.WaitForIdle();
+  EXPECT_EQ(kChildNum, count.load());
+  EXPECT_EQ(0u, runners.count(spawner));
+}
+
+// Meets the other task, which only gets there if they run in parallel.
+static void Meet(std::atomic<int>* arrived, std::atomic<int>* met) {
+  arrived->fetch_add(1);
+  for (int i = 0; i < 1000000 && arrived->load() < 2; ++i) {
+    std::this_thread::yield();
+  }
+  if (arrived->load() == 2) {
+    met->fetch_add(1);
+  }
+}
+
+TEST(ThreadPoolTest, AddTasksRunsInParallel) {
+  ThreadPool pool(2);
+  std::atomic<int> arrived(0);
+  std::atomic<int> met(0);
+  Closure* first = NewCallback(&Meet, &arrived, &met);
+  first->next_closure = NewCallback(&Meet, &arrived, &met);
+  pool.AddTasks(first);
+  pool.WaitForIdle();
+  EXPECT_EQ(2, met.load());
+
+  // From a worker too.
+  std::atomic<int> count(0);
+  pool.AddTask(NewCallback([&pool, &count]() {
+    Closure* head = NULL;
+    for (int i = 0; i < 100; ++i) {
+      Closure* task = NewCallback(&Inc, &count);
+      task->next_closure = head;
+      head = task;
+    }
+    pool.AddTasks(head);
+  }));
+  pool.WaitForIdle();
+  EXPECT_EQ(100, count.load());
+}
+
+TEST(ThreadPoolTest, PinnedWorkers) {
+  ThreadPool pool(2, true);
+  std::atomic<int> count(0);
+  for (int i = 0; i < 100; ++i) {
+    pool.AddTask(NewCallback(&Inc, &count));
+  }
+  pool.WaitForIdle();
+  EXPECT_EQ(100, count.load());
+}
+
+static void AddMany(ThreadPool* pool, std::atomic<int>* count, int n) {
+  for (int i = 0; i < n; ++i) {
+    pool->AddTask(NewCallback(&Inc, count));
+  }
+}
+
+TEST(ThreadPoolTest, ManyProducers) {
+  const int kThreadNum = 8;
+  const int kTaskNum = 5000;
+  ThreadPool pool(4);
+  std::atomic<int> count(0);
+  std::vector<shared_ptr<Thread> > threads(kThreadNum);
+  for (int t = 0; t < kThreadNum; ++t) {
+    threads[t].reset(new Thread(NewCallback(&AddMany, &pool, &count,
+                                            kTaskNum)));
+    threads[t]->Start();
+  }
+  for (int t = 0; t < kThreadNum; ++t) {
+    threads[t]->Join();
+  }
+  pool.WaitForIdle();
+  EXPECT_EQ(kThreadNum * kTaskNum, count.load());
+}
@@ -0,0 +1,309 @@
+#include "common/base/timer_wheel.h"
+
+#include <chrono>
+#include "common/base/clock.h"
+#include "thirdparty/glog/logging.h"
+
+namespace {
+
+const int64_t kSlotMask = TimerWheel::kSlotsPerLevel - 1;
+// Timers further away than this are parked in the last slot of the top
+// level and placed again when it is cascaded.
+const int64_t kMaxDeltaTicks =
+    (static_cast<int64_t>(1) << (TimerWheel::kSlotBits *
+                                 TimerWheel::kNumLevels)) - 1;
+
+}  // namespace
+
+const int TimerWheel::kSlotBits;
+const int TimerWheel::kSlotsPerLevel;
+const int TimerWheel::kNumLevels;
+const uint32_t TimerWheel::kNil;
+
+TimerWheel::TimerWheel(int64_t tick_us)
+    : tick_us_(tick_us),
+      start_us_(MonotonicClock::MicroSeconds()),
+      current_tick_(0),
+      size_(0),
+      stopping_(false) {
+  CHECK_GT(tick_us_, 0);
+  for (int i = 0; i < kNumLevels * kSlotsPerLevel; ++i) {
+    slots_[i] = kNil;
+  }
+}
+
+TimerWheel::~TimerWheel() {
+  Stop();
+  for (size_t i = 0; i < nodes_.size(); ++i) {
+    if (nodes_[i].slot != kNil && !nodes_[i].closure->IsRepeatable()) {
+      delete nodes_[i].closure;
+    }
+  }
+}
+
+TimerWheel::TimerId TimerWheel::Schedule(int64_t deadline_us,
+                                         Closure* closure) {
+  // Rounded up, so the timer never fires early.
+  int64_t expire_tick = 0;
+  if (deadline_us > start_us_) {
+    expire_tick = (deadline_us - start_us_ + tick_us_ - 1) / tick_us_;
+  }
+  return Add(expire_tick, 0, closure);
+}
+
+TimerWheel::TimerId TimerWheel::ScheduleAfter(int64_t delay_us,
+                                              Closure* closure) {
+  return Schedule(MonotonicClock::MicroSeconds() + delay_us, closure);
+}
+
+TimerWheel::TimerId TimerWheel::SchedulePeriodic(int64_t period_us,
+                                                 Closure* closure) {
+  CHECK(closure->IsRepeatable()) << "periodic timers need a permanent closure";
+  int64_t period_ticks = (period_us + tick_us_ - 1) / tick_us_;
+  if (period_ticks < 1) {
+    period_ticks = 1;
+  }
+  int64_t now_us = MonotonicClock::MicroSeconds();
+  int64_t expire_tick =
+      (now_us + period_us - start_us_ + tick_us_ - 1) / tick_us_;
+  return Add(expire_tick, period_ticks, closure);
+}
+
+bool TimerWheel::Cancel(TimerId id) {
+  uint32_t index = static_cast<uint32_t>(id);
+  uint32_t generation = static_cast<uint32_t>(id >> 32);
+  Closure* closure = NULL;
+  bool running = false;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (index >= nodes_.size()) {
+      return false;
+    }
+    Node& node = nodes_[index];
+    if (node.generation != generation || node.slot == kNil) {
+      return false;
+    }
+    closure = node.closure;
+    running = node.running;
+    Unlink(index);
+    Release(index);
+    --size_;
+  }
+  if (running) {
+    return false;
+  }
+  if (!closure->IsRepeatable()) {
+    delete closure;
+  }
+  return true;
+}
+
+void TimerWheel::Start() {
+  CHECK(!driver_.joinable()) << "TimerWheel already started";
+  stopping_ = false;
+  driver_ = std::thread(&TimerWheel::DriverMain, this);
+}
+
+void TimerWheel::Stop() {
+  if (!driver_.joinable()) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  stop_.notify_all();
+  driver_.join();
+}
+
+size_t TimerWheel::Advance(int64_t now_us) {
+  std::vector<Expired> expired;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (now_us < start_us_) {
+      return 0;
+    }
+    expired.swap(expired_);
+    int64_t target_tick = (now_us - start_us_) / tick_us_;
+    if (size_ == 0 && current_tick_ <= target_tick) {
+      // Nothing to cascade or expire on the way.
+      current_tick_ = target_tick + 1;
+    }
+    while (current_tick_ <= target_tick) {
+      // Move the timers of the next coarser slot down a level each time
+      // this level wraps around.
+      for (int level = 1; level < kNumLevels; ++level) {
+        if (((current_tick_ >> (kSlotBits * (level - 1))) & kSlotMask) != 0) {
+          break;
+        }
+        Cascade(level);
+      }
+      ExpireCurrentTick(target_tick, &expired);
+      ++current_tick_;
+    }
+  }
+  size_t count = 0;
+  for (size_t i = 0; i < expired.size(); ++i) {
+    const Expired& entry = expired[i];
+    if (entry.index != kNil) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      Node& node = nodes_[entry.index];
+      if (node.generation != entry.generation) {
+        // Cancelled by a closure run before it in this batch.
+        continue;
+      }
+      node.running = true;
+    }
+    entry.closure->Run();
+    ++count;
+    if (entry.index != kNil) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      Node& node = nodes_[entry.index];
+      if (node.generation == entry.generation) {
+        node.running = false;
+      }
+    }
+  }
+  expired.clear();
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (expired.capacity() > expired_.capacity()) {
+    expired_.swap(expired);
+  }
+  return count;
+}
+
+size_t TimerWheel::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return size_;
+}
+
+TimerWheel::TimerId TimerWheel::Add(int64_t expire_tick,
+                                    int64_t period_ticks,
+                                    Closure* closure) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  uint32_t index;
+  if (!free_nodes_.empty()) {
+    index = free_nodes_.back();
+    free_nodes_.pop_back();
+  } else {
+    index = static_cast<uint32_t>(nodes_.size());
+    Node node;
+    node.generation = 1;
+    node.slot = kNil;
+    node.running = false;
+    nodes_.push_back(node);
+  }
+  Node& node = nodes_[index];
+  node.closure = closure;
+  node.expire_tick = expire_tick;
+  node.period_ticks = period_ticks;
+  Link(index);
+  ++size_;
+  return (static_cast<TimerId>(node.generation) << 32) | index;
+}
+
+void TimerWheel::Link(uint32_t index) {
+  Node& node = nodes_[index];
+  int64_t expire_tick = node.expire_tick;
+  int64_t delta = expire_tick - current_tick_;
+  uint32_t slot;
+  if (delta < 0) {
+    // Already due; runs at the next tick.
+    slot = current_tick_ & kSlotMask;
+  } else {
+    if (delta > kMaxDeltaTicks) {
+      expire_tick = current_tick_ + kMaxDeltaTicks;
+      delta = kMaxDeltaTicks;
+    }
+    int level = 0;
+    while (delta >> (kSlotBits * (level + 1)) != 0) {
+      ++level;
+    }
+    slot = level * kSlotsPerLevel +
+        ((expire_tick >> (kSlotBits * level)) & kSlotMask);
+  }
+  node.slot = slot;
+  node.prev = kNil;
+  node.next = slots_[slot];
+  if (node.next != kNil) {
+    nodes_[node.next].prev = index;
+  }
+  slots_[slot] = index;
+}
+
+void TimerWheel::Unlink(uint32_t index) {
+  Node& node = nodes_[index];
+  if (node.prev != kNil) {
+    nodes_[node.prev].next = node.next;
+  } else {
+    slots_[node.slot] = node.next;
+  }
+  if (node.next != kNil) {
+    nodes_[node.next].prev = node.prev;
+  }
+  node.slot = kNil;
+}
+
+void TimerWheel::Release(uint32_t index) {
+  Node& node = nodes_[index];
+  node.closure = NULL;
+  node.running = false;
+  node.slot = kNil;
+  if (++node.generation == 0) {
+    node.generation = 1;
+  }
+  free_nodes_.push_back(index);
+}
+
+void TimerWheel::Cascade(int level) {
+  uint32_t slot = level * kSlotsPerLevel +
+      ((current_tick_ >> (kSlotBits * level)) & kSlotMask);
+  uint32_t index = slots_[slot];
+  slots_[slot] = kNil;
+  while (index != kNil) {
+    uint32_t next = nodes_[index].next;
+    Link(index);
+    index = next;
+  }
+}
+
+void TimerWheel::ExpireCurrentTick(int64_t target_tick,
+                                   std::vector<Expired>* expired) {
+  uint32_t slot = current_tick_ & kSlotMask;
+  uint32_t index = slots_[slot];
+  slots_[slot] = kNil;
+  while (index != kNil) {
+    Node& node = nodes_[index];
+    uint32_t next = node.next;
+    Expired entry = { node.closure, kNil, 0 };
+    if (node.period_ticks > 0) {
+      entry.index = index;
+      entry.generation = node.generation;
+      // Skip the periods missed while the wheel was behind, rather than
+      // running them back to back in this Advance().
+      node.expire_tick += node.period_ticks;
+      if (node.expire_tick <= target_tick) {
+        node.expire_tick += node.period_ticks *
+            ((target_tick - node.expire_tick) / node.period_ticks + 1);
+      }
+      Link(index);
+    } else {
+      Release(index);
+      --size_;
+    }
+    expired->push_back(entry);
+    index = next;
+  }
+}
+
+void TimerWheel::DriverMain() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (!stopping_) {
+    lock.unlock();
+    int64_t now_us = MonotonicClock::MicroSeconds();
+    Advance(now_us);
+    int64_t wait_us = tick_us_ - (now_us - start_us_) % tick_us_;
+    lock.lock();
+    stop_.wait_for(lock, std::chrono::microseconds(wait_us));
+  }
+}
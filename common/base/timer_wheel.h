@@ -0,0 +1,136 @@
+#ifndef COMMON_BASE_TIMER_WHEEL_H_
+#define COMMON_BASE_TIMER_WHEEL_H_
+
+#include <stdint.h>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "common/base/callback.h"
+
+// TimerWheel runs Closures at MonotonicClock deadlines, in microseconds.
+//
+//   TimerWheel timers;          // 1ms ticks
+//   timers.Start();             // or call Advance() from an event loop
+//   TimerWheel::TimerId id = timers.ScheduleAfter(
+//       50 * 1000, NewCallback(this, &RpcCall::HandleTimeout));
+//   ...
+//   if (timers.Cancel(id)) {
+//     // the timeout will never run
+//   }
+//
+// It is a hierarchical hashed timing wheel: kNumLevels levels of
+// kSlotsPerLevel slots, each level kSlotsPerLevel times coarser than the one
+// below.  Schedule() and Cancel() are O(1), a tick only looks at the slots
+// which are due, and timers are moved down a level at most kNumLevels - 1
+// times in their life.  Timer nodes live in an array which is reused, so
+// once it has grown to the peak number of outstanding timers scheduling
+// doesn't allocate.
+//
+// A timer never fires before its deadline, and at most one tick after it
+// while the wheel is driven on time.  The closures due at a tick are run in
+// one batch, outside the lock, so they may schedule or cancel timers.
+class TimerWheel {
+ public:
+  // 0 is never a valid id.
+  typedef uint64_t TimerId;
+
+  static const int kSlotBits = 6;
+  static const int kSlotsPerLevel = 1 << kSlotBits;
+  static const int kNumLevels = 5;
+
+  explicit TimerWheel(int64_t tick_us = 1000);
+
+  // Stops the driver thread.  Closures of pending timers are not run; the
+  // ones which are not repeatable are deleted.
+  ~TimerWheel();
+
+  // Runs closure at or after deadline_us (MonotonicClock::MicroSeconds()).
+  // Any thread.
+  TimerId Schedule(int64_t deadline_us, Closure* closure);
+
+  // Runs closure delay_us from now.  Any thread.
+  TimerId ScheduleAfter(int64_t delay_us, Closure* closure);
+
+  // Runs closure every period_us, starting period_us from now, until the
+  // timer is cancelled.  closure must be repeatable.  Any thread.
+  TimerId SchedulePeriodic(int64_t period_us, Closure* closure);
+
+  // Returns true if the timer was pending and now never runs; its closure
+  // is deleted unless it is repeatable.  Returns false if it has run, is
+  // being run, or id is unknown.  Doesn't wait for a closure being run.  A
+  // periodic timer due in a batch being run counts as pending until its
+  // own closure starts; cancelled while that runs, it doesn't run again.
+  bool Cancel(TimerId id);
+
+  // Starts a thread which calls Advance() every tick.
+  void Start();
+  // Stops the thread started by Start().
+  void Stop();
+
+  // Runs the closures of all timers due at now_us, returns how many.  For
+  // driving the wheel from an event loop instead of Start().
+  size_t Advance(int64_t now_us);
+
+  // Number of pending timers.
+  size_t size() const;
+
+  int64_t tick_us() const {
+    return tick_us_;
+  }
+
+ private:
+  static const uint32_t kNil = 0xffffffffu;
+
+  struct Node {
+    Closure* closure;
+    // A periodic timer whose closure is being run by Advance().
+    bool running;
+    int64_t expire_tick;
+    int64_t period_ticks;
+    uint32_t prev;
+    uint32_t next;
+    uint32_t generation;
+    // Index into slots_, or kNil when not scheduled.
+    uint32_t slot;
+  };
+
+  // One due closure in the batch run by Advance().  Periodic timers stay
+  // in the wheel meanwhile, so they are looked up again before running.
+  struct Expired {
+    Closure* closure;
+    // kNil for one-shot timers, which are already released.
+    uint32_t index;
+    uint32_t generation;
+  };
+
+  TimerId Add(int64_t expire_tick, int64_t period_ticks, Closure* closure);
+  void Link(uint32_t index);
+  void Unlink(uint32_t index);
+  void Release(uint32_t index);
+  void Cascade(int level);
+  void ExpireCurrentTick(int64_t target_tick, std::vector<Expired>* expired);
+  void DriverMain();
+
+  const int64_t tick_us_;
+  const int64_t start_us_;
+
+  mutable std::mutex mutex_;
+  // Ticks before current_tick_ have been run.
+  int64_t current_tick_;
+  size_t size_;
+  std::vector<Node> nodes_;
+  std::vector<uint32_t> free_nodes_;
+  uint32_t slots_[kNumLevels * kSlotsPerLevel];
+  // Spare batch for Advance(), swapped out while in use so that an
+  // Advance() run from a due closure gets a batch of its own.
+  std::vector<Expired> expired_;
+
+  std::thread driver_;
+  bool stopping_;
+  std::condition_variable stop_;
+
+  DISALLOW_COPY_AND_ASSIGN(TimerWheel);
+};
+
+#endif  // COMMON_BASE_TIMER_WHEEL_H_
@@ -15,7 +15,7 @@ enum ActionErrorCode {
 
 class RpcAction {
  public:
-  RpcAction() { }
+  RpcAction() : missed_deadline_(false) { }
   virtual ~RpcAction() { }
   // 这里不用打包，只是直接调用下游rpc服务
   // 参数closure要传给rpc调用的closure，
@@ -51,8 +51,19 @@ class RpcAction {
     return action_name_;
   }
 
+  // 设置了action超时(RpcStateRunner::set_action_timeout)时，
+  // 超时还没回调的action在RpcState::Finish里missed_deadline()为true，
+  // 之后的回调不再进入ProcessResponse
+  bool missed_deadline() const {
+    return missed_deadline_;
+  }
+  void set_missed_deadline(bool missed_deadline) {
+    missed_deadline_ = missed_deadline;
+  }
+
  protected:
   std::string action_name_;
+  bool missed_deadline_;
 };
 
 CLASS_REGISTER_DEFINE_REGISTRY(rpc_action_register, RpcAction);
@@ -11,13 +11,26 @@ RpcState* RpcContext::CreateState(const std::string& state_name) {
   return state;
 }
 
+RpcState* RpcContext::CreateState(RpcStateId state_id) {
+  if (create_state_by_name_) {
+    return CreateState(GetRpcStateName(state_id));
+  }
+  return CreateRegisteredState(state_id);
+}
+
+RpcState* RpcContext::CreateRegisteredState(RpcStateId state_id) {
+  RpcState* state = CREATE_RPC_STATE(state_id);
+  CHECK_NOTNULL(state);
+  return state;
+}
+
 RpcAction* RpcContext::CreateAction(const std::string& action_name) {
   RpcAction* action = CREATE_RPC_ACTION(action_name);
   CHECK_NOTNULL(action);
   return action;
 }
 
-RpcContext::RpcContext() {
+RpcContext::RpcContext() : strand_(NULL), create_state_by_name_(false) {
   start_time_ = gdt::MonotonicClock::MilliSeconds();
 }
 
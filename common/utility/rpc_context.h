@@ -4,9 +4,10 @@
 
 #include <stdint.h>
 #include <string>
+#include "rpc_state.h"
 
 class RpcAction;
-class RpcState;
+class Strand;
 
 // 保留整个请求流转过程中需要的上下文数据结构
 class RpcContext {
@@ -17,13 +18,39 @@ class RpcContext {
   virtual ~RpcContext() { }
   // 在请求初始化后，确定第一个要进入的state
   virtual std::string GetStartState() = 0;
-  // 由rpc_flow_control调用，创建该请求的一个state实例
+  // 创建该请求的一个state实例
   virtual RpcState* CreateState(const std::string& state_name);
+  // 由rpc_flow_control调用，默认直接按id从注册表创建，不再按名字查表；
+  // 重载了CreateState(state_name)的context要set_create_state_by_name(true)，
+  // 这时转给CreateState(GetRpcStateName(state_id))
+  virtual RpcState* CreateState(RpcStateId state_id);
+  // 按GetRpcStateId的id直接从注册表创建，不再按名字查表
+  RpcState* CreateRegisteredState(RpcStateId state_id);
   // 各个state可以通过CreateAction来创建action，也可以各个state直接new action
   virtual RpcAction* CreateAction(const std::string& action_name);
 
+  // 设置后，该请求各action的ProcessResponse都投递到strand上串行执行，
+  // 写context不用加锁；strand不归context所有，要比请求活得久
+  void set_strand(Strand* strand) {
+    strand_ = strand;
+  }
+  Strand* strand() const {
+    return strand_;
+  }
+
+  // 重载了CreateState(state_name)的context在构造函数里设置为true，
+  // 默认false，见CreateState(RpcStateId)
+  void set_create_state_by_name(bool create_state_by_name) {
+    create_state_by_name_ = create_state_by_name;
+  }
+  bool create_state_by_name() const {
+    return create_state_by_name_;
+  }
+
  private:
   int64_t start_time_;
+  Strand* strand_;
+  bool create_state_by_name_;
 };
 
 #endif  // RPC_CONTEXT_H_
@@ -60,3 +60,56 @@ TEST(RpcContextTest, CreateStateTest) {
   delete state;
 }
 
+
+TEST(RpcContextTest, CreateStateByIdTest) {
+  TestContext test_context;
+  RpcStateId state_id = GetRpcStateId("TestState");
+  EXPECT_NE(kInvalidRpcStateId, state_id);
+  EXPECT_EQ("TestState", GetRpcStateName(state_id));
+  RpcState* state = test_context.CreateState(state_id);
+  EXPECT_TRUE(dynamic_cast<TestState*>(state) != NULL);
+  delete state;
+  state = test_context.CreateRegisteredState(state_id);
+  EXPECT_TRUE(dynamic_cast<TestState*>(state) != NULL);
+  delete state;
+
+  EXPECT_EQ(kRpcStateEndId, GetRpcStateId(kRpcStateEnd));
+  EXPECT_EQ(kInvalidRpcStateId, GetRpcStateId("test"));
+}
+
+class NamingContext : public RpcContext {
+ public:
+  explicit NamingContext(bool create_state_by_name) : created_num(0) {
+    set_create_state_by_name(create_state_by_name);
+  }
+  std::string GetStartState() {
+    return "test";
+  }
+  RpcState* CreateState(const std::string& state_name) {
+    ++created_num;
+    return RpcContext::CreateState(state_name);
+  }
+  using RpcContext::CreateState;
+
+  int created_num;
+};
+
+// 设置了create_state_by_name，按id创建时也走按名字创建的重载
+TEST(RpcContextTest, CreateStateByIdUsesNameOverride) {
+  NamingContext naming_context(true);
+  RpcContext* context = &naming_context;
+  RpcState* state = context->CreateState(GetRpcStateId("TestState"));
+  EXPECT_TRUE(dynamic_cast<TestState*>(state) != NULL);
+  EXPECT_EQ(1, naming_context.created_num);
+  delete state;
+}
+
+// 默认按id直接创建，不经过名字
+TEST(RpcContextTest, CreateStateByIdSkipsNames) {
+  NamingContext naming_context(false);
+  RpcContext* context = &naming_context;
+  RpcState* state = context->CreateState(GetRpcStateId("TestState"));
+  EXPECT_TRUE(dynamic_cast<TestState*>(state) != NULL);
+  EXPECT_EQ(0, naming_context.created_num);
+  delete state;
+}
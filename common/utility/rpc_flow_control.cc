@@ -3,6 +3,10 @@
 #include <string>
 
 #include "base/barrier_closure.h"
+#include "base/clock.h"
+#include "base/deadline_barrier.h"
+#include "base/strand.h"
+#include "base/thread_pool.h"
 #include "rpc_state.h"
 #include "rpc_action.h"
 #include "rpc_context.h"
@@ -15,11 +19,10 @@ void RpcActionRunner::RunAction(
   CHECK(action_ != NULL);
   done_ = done;
 
-  Closure* call_done = ::NewCallback(
-      this, &RpcActionRunner::HandleActionDone);
-  int ret = action->CallService(context, call_done);
+  call_done_.Bind(this, &RpcActionRunner::HandleActionDone);
+  int ret = action->CallService(context, &call_done_);
   if (ret != kActionSucceed) {
-    delete call_done;
+    call_done_.Reset();
     if (done != NULL) {
       done->Run();
     }
@@ -27,7 +30,31 @@ void RpcActionRunner::RunAction(
   }
 }
 
+void RpcActionRunner::RunAction(
+    RpcContext* context, const shared_ptr<RpcAction>& action, Closure* done) {
+  action_ref_ = action;
+  RunAction(context, action.get(), done);
+}
+
 void RpcActionRunner::HandleActionDone() {
+  if (deadline_barrier_ != NULL &&
+      !deadline_barrier_->Claim(participant_index_)) {
+    // 已经超时，state不再等这个action，context可能没了
+    done_->Run();
+    delete this;
+    return;
+  }
+  Strand* strand = context_ != NULL ? context_->strand() : NULL;
+  if (strand != NULL && !strand->RunningInThisThread()) {
+    // call_done_已经跑过，重新绑定后投递到strand，不用另外分配
+    call_done_.Bind(this, &RpcActionRunner::FinishAction);
+    strand->AddTask(&call_done_);
+    return;
+  }
+  FinishAction();
+}
+
+void RpcActionRunner::FinishAction() {
   action_->ProcessResponse(context_);
   if (done_ != NULL) {
     done_->Run();
@@ -38,33 +65,127 @@ void RpcActionRunner::HandleActionDone() {
 void RpcStateRunner::RunState(
     RpcContext* context, RpcState* state,
     std::string* next_state_name, Closure* done) {
+  next_state_name_ = next_state_name;
+  next_state_id_ = NULL;
+  StartState(context, state, done);
+}
+
+void RpcStateRunner::RunState(
+    RpcContext* context, RpcState* state,
+    RpcStateId* next_state_id, Closure* done) {
+  next_state_name_ = NULL;
+  next_state_id_ = next_state_id;
+  StartState(context, state, done);
+}
+
+void RpcStateRunner::StartState(
+    RpcContext* context, RpcState* state, Closure* done) {
   context_ = context;
   state_ = state;
   CHECK(state_ != NULL);
-  next_state_name_ = next_state_name;
   done_ = done;
 
-  state->MakeUpActions(context, &state_actions_);
-  Closure* state_done = ::NewCallback(
-      this, &RpcStateRunner::HandleStateDone);
-  Closure* barrier_done = new BarrierClosure(
-      state_actions_.size() + 1, state_done);
+  state_actions_.clear();
+  state_done_.Bind(this, &RpcStateRunner::HandleStateDone);
+  if (timer_wheel_ != NULL) {
+    RunActionsWithDeadline();
+    return;
+  }
+  phaser_.Reset(&state_done_);
+  if (!state->LaunchActions(context, this)) {
+    state->MakeUpActions(context, &state_actions_);
+    phaser_.Add(state_actions_.size());
+    for (uint32_t i = 0; i < state_actions_.size(); ++i) {
+      RunAction(i, &phaser_, NULL,
+                thread_pool_ != NULL && i + 1 < state_actions_.size());
+    }
+  }
+  // 之后可能已经在跑下一个state，或者runner已经delete
+  phaser_.Seal();
+}
+
+void RpcStateRunner::Launch(const shared_ptr<RpcAction>& action) {
+  state_actions_.push_back(action);
+  phaser_.Add(1);
+  // 不知道是不是最后一个，有thread_pool_时都放上去，马上开始执行
+  RunAction(state_actions_.size() - 1, &phaser_, NULL, thread_pool_ != NULL);
+}
+
+void RpcStateRunner::RunAction(int index, Closure* done,
+                               DeadlineBarrier* deadline_barrier,
+                               bool on_thread_pool) {
+  RpcActionRunner* action_runner = RpcActionRunner::Create();
+  const shared_ptr<RpcAction>& action = state_actions_[index];
+  if (deadline_barrier != NULL) {
+    action_runner->set_deadline_barrier(deadline_barrier, index);
+  }
+  if (on_thread_pool) {
+    void (RpcActionRunner::*run_action)(
+        RpcContext*, const shared_ptr<RpcAction>&, Closure*) =
+        &RpcActionRunner::RunAction;
+    thread_pool_->AddTask(NewCallback(
+        action_runner, run_action, context_, action, done));
+  } else {
+    action_runner->RunAction(context_, action, done);
+  }
+}
+
+// 设置了超时就每个state new一个DeadlineBarrier，action个数要事先知道
+void RpcStateRunner::RunActionsWithDeadline() {
+  state_->MakeUpActions(context_, &state_actions_);
+  DeadlineBarrier* deadline_barrier = new DeadlineBarrier(
+      state_actions_.size(),
+      MonotonicClock::MicroSeconds() + action_timeout_us_, timer_wheel_,
+      NewCallback(this, &RpcStateRunner::PostLateActions));
   for (uint32_t i = 0; i < state_actions_.size(); ++i) {
-    RpcActionRunner* action_runner = RpcActionRunner::Create();
-    action_runner->RunAction(context, state_actions_[i].get(), barrier_done);
+    state_actions_[i]->set_missed_deadline(false);
+    RunAction(i, deadline_barrier->participant(i), deadline_barrier,
+              thread_pool_ != NULL && i + 1 < state_actions_.size());
   }
-  barrier_done->Run();
+  deadline_barrier->Start();
+}
+
+// 超时在TimerWheel的驱动线程上回调，Finish、下个state的MakeUpActions
+// 和CallService都不能在那里跑，否则挡住别的定时器：
+// 有strand就投递到strand上，和ProcessResponse串行；否则投递到thread_pool_；
+// 都没有才直接执行
+void RpcStateRunner::PostLateActions(const std::vector<int>& late_actions) {
+  Strand* strand = context_->strand();
+  if (strand != NULL) {
+    strand->AddTask(NewCallback(
+        this, &RpcStateRunner::HandleLateActions, late_actions));
+  } else if (thread_pool_ != NULL) {
+    thread_pool_->AddTask(NewCallback(
+        this, &RpcStateRunner::HandleLateActions, late_actions));
+  } else {
+    HandleLateActions(late_actions);
+  }
+}
+
+void RpcStateRunner::HandleLateActions(const std::vector<int>& late_actions) {
+  for (size_t i = 0; i < late_actions.size(); ++i) {
+    state_actions_[late_actions[i]]->set_missed_deadline(true);
+  }
+  HandleStateDone();
 }
 
 void RpcStateRunner::HandleStateDone() {
-  std::string state_name = state_->Finish(context_, state_actions_);
-  if (next_state_name_ != NULL) {
-    *next_state_name_ = state_name;
+  if (next_state_id_ != NULL) {
+    *next_state_id_ = state_->FinishWithId(context_, state_actions_);
+  } else {
+    std::string state_name = state_->Finish(context_, state_actions_);
+    if (next_state_name_ != NULL) {
+      *next_state_name_ = state_name;
+    }
   }
+  // done_可能直接用这个runner跑下一个state，先取出需要的成员
+  bool delete_when_done = delete_when_done_;
   if (done_ != NULL) {
     done_->Run();
   }
-  delete this;
+  if (delete_when_done) {
+    delete this;
+  }
 }
 
 void RpcFlowControl::Run(RpcContext* context,
@@ -74,9 +195,12 @@ void RpcFlowControl::Run(RpcContext* context,
   CHECK_NOTNULL(context_);
   own_context_ = own_context;
   done_ = done;
-  start_state_ = context_->GetStartState();
-  end_state_ = kRpcStateEnd;
-  RunState(start_state_);;
+  std::string start_state = context_->GetStartState();
+  start_state_ = GetRpcStateId(start_state);
+  CHECK_NE(kInvalidRpcStateId, start_state_)
+      << "unregistered start state " << start_state;
+  end_state_ = kRpcStateEndId;
+  RunState(start_state_);
 }
 
 
@@ -89,28 +213,30 @@ void RpcFlowControl::Run(RpcContext* context,
   CHECK_NOTNULL(context_);
   own_context_ = own_context;
   done_ = done;
-  start_state_ = start_state;
-  end_state_ = end_state;
+  start_state_ = GetRpcStateId(start_state);
+  CHECK_NE(kInvalidRpcStateId, start_state_)
+      << "unregistered start state " << start_state;
+  end_state_ = GetRpcStateId(end_state);
   RunState(start_state_);
 }
 
-void RpcFlowControl::RunState(const std::string& state_name) {
-  current_state_name_ = state_name;
-  current_state_.reset(context_->CreateState(state_name));
+void RpcFlowControl::RunState(RpcStateId state_id) {
+  current_state_id_ = state_id;
+  current_state_.reset(context_->CreateState(state_id));
   CHECK_NOTNULL(current_state_.get());
-  VLOG(50) << "enter state:" << state_name;
+  VLOG(50) << "enter state:" << GetRpcStateName(state_id);
 
-  RpcStateRunner* state_runner = RpcStateRunner::Create();
-  Closure* done = ::NewCallback(this, &RpcFlowControl::CurrentStateFinish);
-  state_runner->RunState(context_, current_state_.get(),
-                         &next_state_name_, done);
+  state_runner_.set_thread_pool(thread_pool_);
+  state_finish_.Bind(this, &RpcFlowControl::CurrentStateFinish);
+  state_runner_.RunState(context_, current_state_.get(),
+                         &next_state_id_, &state_finish_);
 }
 
 void RpcFlowControl::CurrentStateFinish() {
-  VLOG(50) << "current state:" << current_state_name_ << " Finish,"
-           << "next state:" << next_state_name_;
-  if (current_state_name_ == end_state_ ||
-      next_state_name_ == kRpcStateEnd) {
+  VLOG(50) << "current state:" << GetRpcStateName(current_state_id_)
+           << " Finish," << "next state:" << GetRpcStateName(next_state_id_);
+  if (current_state_id_ == end_state_ ||
+      next_state_id_ == kRpcStateEndId) {
     VLOG(50) << "flow control finish.";
     if (done_ != NULL) {
       done_->Run();
@@ -122,6 +248,8 @@ void RpcFlowControl::CurrentStateFinish() {
     delete this;
     return;
   }
-  RunState(next_state_name_);
+  CHECK_NE(kInvalidRpcStateId, next_state_id_)
+      << "unregistered next state of " << GetRpcStateName(current_state_id_);
+  RunState(next_state_id_);
 }
 
@@ -6,16 +6,21 @@
 #ifndef RPC_FLOW_CONTROL_H_
 #define RPC_FLOW_CONTROL_H_
 
+#include <stdint.h>
 #include <vector>
 #include <string>
 #include "base/callback.h"
 #include "base/shared_ptr.h"
 #include "base/barrier_closure.h"
+#include "base/inline_callback.h"
 #include "rpc_action.h"
 #include "rpc_state.h"
 #include "thirdparty/glog/logging.h"
 
+class DeadlineBarrier;
 class RpcContext;
+class ThreadPool;
+class TimerWheel;
 
 class RpcActionRunner {
  public:
@@ -23,43 +28,108 @@ class RpcActionRunner {
     return new RpcActionRunner();
   }
   ~RpcActionRunner() {}
+  // action由调用者管理，要活到done回调
   void RunAction(RpcContext* context,
                  RpcAction* action,
                  Closure* done);
+  // runner持有action直到CallService的回调到达，
+  // 超时的action在state结束后才回调也不会提前释放
+  void RunAction(RpcContext* context,
+                 const shared_ptr<RpcAction>& action,
+                 Closure* done);
+
+  // done是barrier->participant(index)时设置；回调时先Claim，
+  // 已经超时的action不再ProcessResponse
+  void set_deadline_barrier(DeadlineBarrier* barrier, int index) {
+    deadline_barrier_ = barrier;
+    participant_index_ = index;
+  }
 
  private:
-  RpcActionRunner() : context_(NULL), action_(NULL), done_(NULL) {}
+  RpcActionRunner()
+    : context_(NULL), action_(NULL), done_(NULL),
+      deadline_barrier_(NULL), participant_index_(0) {}
   void HandleActionDone();
+  void FinishAction();
 
  private:
   RpcContext* context_;
   RpcAction* action_;
+  shared_ptr<RpcAction> action_ref_;
   Closure* done_;
+  DeadlineBarrier* deadline_barrier_;
+  int participant_index_;
+  // 传给action的回调，嵌在runner里，不再单独new
+  InlineCallback<void()> call_done_;
 };
 
-class RpcStateRunner {
+class RpcStateRunner : public RpcActionLauncher {
  public:
   static RpcStateRunner* Create() {
-    return new RpcStateRunner;
+    return new RpcStateRunner(true);
   }
   ~RpcStateRunner() {}
   void RunState(RpcContext* context,
                 RpcState* state,
                 std::string* next_state_name,
                 Closure* done);
+  // 同上，下个state用id表示，调用RpcState::FinishWithId
+  void RunState(RpcContext* context,
+                RpcState* state,
+                RpcStateId* next_state_id,
+                Closure* done);
+
+  // RpcState::LaunchActions构造好一个action就调用，马上开始执行
+  virtual void Launch(const shared_ptr<RpcAction>& action);
+
+  // 设置后，除最后一个外的action都放到thread_pool上并发执行，
+  // 最后一个仍在当前线程执行；LaunchActions构造的action都放到thread_pool上。
+  // 各action的CallService需要能并发调用
+  void set_thread_pool(ThreadPool* thread_pool) {
+    thread_pool_ = thread_pool;
+  }
+
+  // 设置后，state开始timeout_us后还没回调的action算超时，
+  // 不再等它，直接进入RpcState::Finish，见RpcAction::missed_deadline；
+  // 这时的Finish投递到context的strand或者thread_pool上，不占TimerWheel的线程
+  void set_action_timeout(TimerWheel* timer_wheel, int64_t timeout_us) {
+    timer_wheel_ = timer_wheel;
+    action_timeout_us_ = timeout_us;
+  }
 
  private:
-  RpcStateRunner()
+  // RpcFlowControl里嵌一个runner，跑完一个state不delete，留给下个state
+  friend class RpcFlowControl;
+
+  explicit RpcStateRunner(bool delete_when_done)
     : context_(NULL), state_(NULL),
-      next_state_name_(NULL), done_(NULL) {}
+      next_state_name_(NULL), next_state_id_(NULL), done_(NULL),
+      thread_pool_(NULL),
+      timer_wheel_(NULL), action_timeout_us_(0),
+      delete_when_done_(delete_when_done) {}
+  void StartState(RpcContext* context, RpcState* state, Closure* done);
+  void RunAction(int index, Closure* done,
+                 DeadlineBarrier* deadline_barrier, bool on_thread_pool);
+  void RunActionsWithDeadline();
+  void PostLateActions(const std::vector<int>& late_actions);
+  void HandleLateActions(const std::vector<int>& late_actions);
   void HandleStateDone();
 
  private:
   RpcContext* context_;
   RpcState* state_;
   std::string* next_state_name_;
+  RpcStateId* next_state_id_;
   Closure* done_;
+  ThreadPool* thread_pool_;
+  TimerWheel* timer_wheel_;
+  int64_t action_timeout_us_;
+  bool delete_when_done_;
   std::vector<shared_ptr<RpcAction> > state_actions_;
+  InlineCallback<void()> state_done_;
+  // 每个state重新Reset，不再每次new BarrierClosure；
+  // action边构造边登记，构造完Seal
+  PhaserClosure phaser_;
 };
 
 class RpcFlowControl {
@@ -85,13 +155,30 @@ class RpcFlowControl {
            const std::string& end_state,
            Closure* done = NULL);
 
+  // 每个state的action fan-out到thread_pool上执行，见RpcStateRunner;
+  // 默认为NULL，所有action都在调用线程上执行
+  void set_thread_pool(ThreadPool* thread_pool) {
+    thread_pool_ = thread_pool;
+  }
+
+  // 每个state的action超时，见RpcStateRunner::set_action_timeout
+  void set_action_timeout(TimerWheel* timer_wheel, int64_t timeout_us) {
+    state_runner_.set_action_timeout(timer_wheel, timeout_us);
+  }
+
  private:
   RpcFlowControl()
     : context_(NULL),
       own_context_(true),
-      done_(NULL) { }
+      done_(NULL),
+      thread_pool_(NULL),
+      start_state_(kInvalidRpcStateId),
+      end_state_(kInvalidRpcStateId),
+      current_state_id_(kInvalidRpcStateId),
+      next_state_id_(kInvalidRpcStateId),
+      state_runner_(false) { }
 
-  void RunState(const std::string& state_name);
+  void RunState(RpcStateId state_id);
 
   void CurrentStateFinish();
 
@@ -99,12 +186,18 @@ class RpcFlowControl {
   RpcContext* context_;
   bool own_context_;
   Closure* done_;
+  ThreadPool* thread_pool_;
 
-  std::string start_state_;
-  std::string end_state_;
+  // state跳转都用id，不再每次构造名字、查表
+  RpcStateId start_state_;
+  RpcStateId end_state_;
   shared_ptr<RpcState> current_state_;
-  std::string current_state_name_;
-  std::string next_state_name_;
+  RpcStateId current_state_id_;
+  RpcStateId next_state_id_;
+  // 每个state结束时的回调，在CurrentStateFinish里重新绑定给下一个state
+  InlineCallback<void()> state_finish_;
+  // 各个state共用的runner
+  RpcStateRunner state_runner_;
 };
 
 #endif  // RPC_FLOW_CONTROL_H_
@@ -0,0 +1,133 @@
+#include <stdlib.h>
+#include <new>
+#include <string>
+#include <vector>
+#include "rpc_flow_control.h"
+#include "rpc_action.h"
+#include "rpc_state.h"
+#include "rpc_context.h"
+#include "thirdparty/benchmark/benchmark.h"
+
+// 跑一遍10个state的流程，每个state带kActionNum个立即完成的action；
+// 除了耗时，allocs是每个流程的operator new次数
+//
+//   rpc_flow_control_benchmark --benchmark_format=json
+
+// 只在单线程里统计；noinline免得GCC把里面的malloc/free和new/delete对不上
+static int64_t g_allocation_count = 0;
+
+__attribute__((noinline))
+void* operator new(size_t size) {
+  ++g_allocation_count;
+  void* p = malloc(size == 0 ? 1 : size);
+  if (p == NULL) {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+__attribute__((noinline))
+void operator delete(void* p) noexcept {
+  free(p);
+}
+
+__attribute__((noinline))
+void operator delete(void* p, size_t) noexcept {
+  free(p);
+}
+
+static const int kStateNum = 10;
+static const int kActionNum = 3;
+
+static const char* const kStateNames[kStateNum] = {
+  "ChainState0", "ChainState1", "ChainState2", "ChainState3", "ChainState4",
+  "ChainState5", "ChainState6", "ChainState7", "ChainState8", "ChainState9",
+};
+
+class NopAction : public RpcAction {
+ public:
+  virtual int CallService(RpcContext* context, Closure* done) {
+    done->Run();
+    return kActionSucceed;
+  }
+  virtual void ProcessResponse(RpcContext* context) { }
+};
+
+// action在context里建好，各个state共用，不算在流程的分配里
+class ChainContext : public RpcContext {
+ public:
+  explicit ChainContext(bool by_id) : finish_with_id(by_id) {
+    for (int i = 0; i < kActionNum; ++i) {
+      actions.push_back(shared_ptr<RpcAction>(new NopAction));
+    }
+  }
+  std::string GetStartState() {
+    return kStateNames[0];
+  }
+
+  std::vector<shared_ptr<RpcAction> > actions;
+  // false时走默认的FinishWithId，按Finish返回的名字查id
+  bool finish_with_id;
+};
+
+template <int N>
+class ChainState : public RpcState {
+ public:
+  void MakeUpActions(RpcContext* context,
+                     std::vector<shared_ptr<RpcAction> >* actions) {
+    const ChainContext* chain_context = static_cast<ChainContext*>(context);
+    actions->insert(actions->end(), chain_context->actions.begin(),
+                    chain_context->actions.end());
+  }
+  std::string Finish(RpcContext* context,
+                     const std::vector<shared_ptr<RpcAction> >& actions) {
+    return N + 1 < kStateNum ? kStateNames[N + 1] : kRpcStateEnd;
+  }
+  // 按id跳转，不构造名字、不查表
+  RpcStateId FinishWithId(RpcContext* context,
+                          const std::vector<shared_ptr<RpcAction> >& actions) {
+    if (!static_cast<ChainContext*>(context)->finish_with_id) {
+      return RpcState::FinishWithId(context, actions);
+    }
+    static const RpcStateId kNextState =
+        GetRpcStateId(Finish(context, actions));
+    return kNextState;
+  }
+};
+
+typedef ChainState<0> ChainState0;
+typedef ChainState<1> ChainState1;
+typedef ChainState<2> ChainState2;
+typedef ChainState<3> ChainState3;
+typedef ChainState<4> ChainState4;
+typedef ChainState<5> ChainState5;
+typedef ChainState<6> ChainState6;
+typedef ChainState<7> ChainState7;
+typedef ChainState<8> ChainState8;
+typedef ChainState<9> ChainState9;
+REGISTER_RPC_STATE(ChainState0);
+REGISTER_RPC_STATE(ChainState1);
+REGISTER_RPC_STATE(ChainState2);
+REGISTER_RPC_STATE(ChainState3);
+REGISTER_RPC_STATE(ChainState4);
+REGISTER_RPC_STATE(ChainState5);
+REGISTER_RPC_STATE(ChainState6);
+REGISTER_RPC_STATE(ChainState7);
+REGISTER_RPC_STATE(ChainState8);
+REGISTER_RPC_STATE(ChainState9);
+
+static void BM_RunTenStates(benchmark::State& state) {
+  ChainContext context(state.range(0) != 0);
+  int64_t allocation_count = g_allocation_count;
+  for (auto _ : state) {
+    RpcFlowControl::Create()->Run(&context, false);
+  }
+  allocation_count = g_allocation_count - allocation_count;
+  state.SetItemsProcessed(state.iterations());
+  state.counters["allocs"] =
+      static_cast<double>(allocation_count) / state.iterations();
+}
+// 参数0: 默认的FinishWithId；1: 重载的FinishWithId
+BENCHMARK(BM_RunTenStates)->Arg(0)->Arg(1);
+
+BENCHMARK_MAIN();
@@ -1,15 +1,57 @@
 
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+#include <string>
+#include <thread>
 #include <vector>
 #include "rpc_flow_control.h"
 #include "rpc_action.h"
 #include "rpc_state.h"
 #include "rpc_context.h"
+#include "base/clock.h"
+#include "base/executor_callback.h"
+#include "base/strand.h"
+#include "base/thread_pool.h"
+#include "base/timer_wheel.h"
 #include "rpc/rpc_test_helper.h"
 #include "thirdparty/gtest/gtest.h"
 #include "thirdparty/glog/logging.h"
 
 using namespace gdt::rpc::test;  // NOLINT
 
+// 统计测试期间的operator new次数，只在单线程的用例里打开
+static bool g_count_allocations = false;
+static int g_allocation_count = 0;
+
+void* operator new(size_t size) {
+  if (g_count_allocations) {
+    ++g_allocation_count;
+  }
+  void* p = malloc(size == 0 ? 1 : size);
+  if (p == NULL) {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+void operator delete(void* p) throw() {
+  free(p);
+}
+
+// 作用域内的分配属于用户代码(state/action)，不计入流程本身的分配
+class UncountedAllocationScope {
+ public:
+  UncountedAllocationScope() : saved_(g_count_allocations) {
+    g_count_allocations = false;
+  }
+  ~UncountedAllocationScope() {
+    g_count_allocations = saved_;
+  }
+ private:
+  bool saved_;
+};
+
 class TestContext : public RpcContext {
  public:
   void Init(google::protobuf::RpcController* controller,
@@ -180,6 +222,24 @@ TEST(RpcFlowControlTest, Test0) {
   EXPECT_TRUE(flag);
 }
 
+TEST(RpcFlowControlTest, RunActionsOnThreadPool) {
+  ThreadPool thread_pool(4);
+  IncRequest request;
+  request.set_count(1);  // 从DoubleState开始
+  request.set_step(1);
+  IncResponse response;
+  bool flag = false;
+  TestContext* context = new TestContext();
+  context->Init(NULL, &request, &response, NewCallback(&SetFlag, &flag));
+  RpcFlowControl* flow_control = RpcFlowControl::Create();
+  flow_control->set_thread_pool(&thread_pool);
+  flow_control->Run(context);
+  // Run返回后剩下的工作都在thread_pool上
+  thread_pool.WaitForIdle();
+  EXPECT_EQ(15, response.result());
+  EXPECT_TRUE(flag);
+}
+
 TEST(RpcFlowControlTest, RunSpecifiedState) {
   IncRequest request;
   request.set_count(1);
@@ -193,6 +253,20 @@ TEST(RpcFlowControlTest, RunSpecifiedState) {
   EXPECT_EQ(9, response.result());
 }
 
+TEST(RpcFlowControlTest, UnregisteredStartStateDies) {
+  IncRequest request;
+  request.set_count(1);
+  request.set_step(1);
+  IncResponse response;
+  TestContext* context = new TestContext();
+  context->Init(NULL, &request, &response, NULL);
+  RpcFlowControl* flow_control = RpcFlowControl::Create();
+  EXPECT_DEATH(flow_control->Run(context, true, "NoSuchState", kRpcStateEnd),
+               "kInvalidRpcStateId");
+  delete flow_control;
+  delete context;
+}
+
 TEST(RpcFlowControlTest, RpcStateRunnerTest) {
   IncRequest request;
   request.set_count(1);
@@ -209,6 +283,22 @@ TEST(RpcFlowControlTest, RpcStateRunnerTest) {
   EXPECT_EQ("TripleState", next_state_name);
 }
 
+TEST(RpcFlowControlTest, RpcStateRunnerIdTest) {
+  IncRequest request;
+  request.set_count(1);
+  request.set_step(1);
+  IncResponse response;
+  TestContext context;
+  context.Init(NULL, &request, &response, NULL);
+  RpcStateRunner* state_runner = RpcStateRunner::Create();
+  DoubleState double_state;
+  RpcStateId next_state_id = kInvalidRpcStateId;
+  state_runner->RunState(&context, &double_state, &next_state_id, NULL);
+  EXPECT_EQ(9, response.result());
+  EXPECT_EQ(GetRpcStateId("TripleState"), next_state_id);
+  EXPECT_EQ("TripleState", GetRpcStateName(next_state_id));
+}
+
 TEST(RpcFlowControlTest, RpcActionRunnerTest) {
   DoubleAction double_action;
   int result = 1;
@@ -218,3 +308,417 @@ TEST(RpcFlowControlTest, RpcActionRunnerTest) {
   action_runner->RunAction(NULL, &double_action, NULL);
   EXPECT_EQ(2, result);
 }
+
+static void SetFlagOnWorker(ThreadPool* thread_pool, bool* flag) {
+  *flag = thread_pool->IsWorkerThread();
+}
+
+TEST(RpcFlowControlTest, RpcActionRunnerDoneOnExecutor) {
+  ThreadPool thread_pool(1);
+  DoubleAction double_action;
+  int result = 1;
+  double_action.Init(&result);
+  bool flag = false;
+  // done不在完成action的线程上跑，而是投递到thread_pool
+  RpcActionRunner::Create()->RunAction(
+      NULL, &double_action,
+      NewCallbackOn(&thread_pool, &SetFlagOnWorker, &thread_pool, &flag));
+  thread_pool.WaitForIdle();
+  EXPECT_EQ(2, result);
+  EXPECT_TRUE(flag);
+}
+
+// CallService的done投递到io_pool上跑(相当于在I/O线程上完成)，
+// ProcessResponse不加锁地写context
+class CountContext : public RpcContext {
+ public:
+  CountContext() : io_pool(NULL), responses(0) {}
+  std::string GetStartState() {
+    return "CountResponseState";
+  }
+
+  ThreadPool* io_pool;
+  int responses;
+};
+
+class CountResponseAction : public RpcAction {
+ public:
+  virtual int CallService(RpcContext* context, Closure* done) {
+    static_cast<CountContext*>(context)->io_pool->AddTask(done);
+    return kActionSucceed;
+  }
+  virtual void ProcessResponse(RpcContext* context) {
+    ++static_cast<CountContext*>(context)->responses;
+  }
+};
+
+static const int kCountActionNum = 16;
+
+class CountResponseState : public RpcState {
+ public:
+  void MakeUpActions(RpcContext* context,
+                     std::vector<shared_ptr<RpcAction> >* actions) {
+    for (int i = 0; i < kCountActionNum; ++i) {
+      actions->push_back(shared_ptr<RpcAction>(new CountResponseAction));
+    }
+  }
+  std::string Finish(RpcContext* context,
+                     const std::vector<shared_ptr<RpcAction> >& actions) {
+    return kRpcStateEnd;
+  }
+};
+REGISTER_RPC_STATE(CountResponseState);
+
+TEST(RpcFlowControlTest, ProcessResponseOnStrand) {
+  ThreadPool thread_pool(4);
+  Strand strand(&thread_pool);
+  CountContext context;
+  context.io_pool = &thread_pool;
+  context.set_strand(&strand);
+  bool flag = false;
+  RpcFlowControl::Create()->Run(&context, false,
+                                NewCallback(&SetFlag, &flag));
+  thread_pool.WaitForIdle();
+  EXPECT_EQ(kCountActionNum, context.responses);
+  EXPECT_TRUE(flag);
+}
+
+// 偶数号action马上回调，奇数号的done先存在context里，由测试决定何时回调
+class StallContext : public RpcContext {
+ public:
+  StallContext() : responses(0), destroyed_actions(0) {}
+  std::string GetStartState() {
+    return "StallState";
+  }
+
+  std::vector<Closure*> stalled;
+  int responses;
+  int destroyed_actions;
+  std::vector<bool> missed_deadline;
+  std::thread::id finish_thread;
+};
+
+class StallAction : public RpcAction {
+ public:
+  explicit StallAction(bool stall) : stall_(stall), destroyed_(NULL) {}
+  ~StallAction() {
+    if (destroyed_ != NULL) {
+      ++*destroyed_;
+    }
+  }
+  virtual int CallService(RpcContext* context, Closure* done) {
+    destroyed_ = &static_cast<StallContext*>(context)->destroyed_actions;
+    if (stall_) {
+      static_cast<StallContext*>(context)->stalled.push_back(done);
+    } else {
+      done->Run();
+    }
+    return kActionSucceed;
+  }
+  virtual void ProcessResponse(RpcContext* context) {
+    ++static_cast<StallContext*>(context)->responses;
+  }
+
+ private:
+  bool stall_;
+  int* destroyed_;
+};
+
+class StallState : public RpcState {
+ public:
+  void MakeUpActions(RpcContext* context,
+                     std::vector<shared_ptr<RpcAction> >* actions) {
+    for (int i = 0; i < 4; ++i) {
+      actions->push_back(shared_ptr<RpcAction>(new StallAction(i % 2 == 1)));
+    }
+  }
+  std::string Finish(RpcContext* context,
+                     const std::vector<shared_ptr<RpcAction> >& actions) {
+    StallContext* stall_context = static_cast<StallContext*>(context);
+    for (size_t i = 0; i < actions.size(); ++i) {
+      stall_context->missed_deadline.push_back(actions[i]->missed_deadline());
+    }
+    stall_context->finish_thread = std::this_thread::get_id();
+    return kRpcStateEnd;
+  }
+};
+REGISTER_RPC_STATE(StallState);
+
+TEST(RpcFlowControlTest, ActionTimeout) {
+  TimerWheel timers(1000);
+  int64_t now = MonotonicClock::MicroSeconds();
+  StallContext context;
+  bool flag = false;
+  RpcFlowControl* flow_control = RpcFlowControl::Create();
+  flow_control->set_action_timeout(&timers, 5000);
+  flow_control->Run(&context, false, NewCallback(&SetFlag, &flag));
+  ASSERT_EQ(2u, context.stalled.size());
+
+  // 一个按时回调，另一个超时
+  context.stalled[0]->Run();
+  EXPECT_FALSE(flag);
+  timers.Advance(now + 1000 * 1000);
+  EXPECT_TRUE(flag);
+  EXPECT_EQ(3, context.responses);
+  ASSERT_EQ(4u, context.missed_deadline.size());
+  EXPECT_FALSE(context.missed_deadline[0]);
+  EXPECT_FALSE(context.missed_deadline[1]);
+  EXPECT_FALSE(context.missed_deadline[2]);
+  EXPECT_TRUE(context.missed_deadline[3]);
+
+  // 超时的action由它的runner持有，等到回调才释放
+  EXPECT_EQ(3, context.destroyed_actions);
+
+  // 流程结束后才回调，不再ProcessResponse
+  context.stalled[1]->Run();
+  EXPECT_EQ(3, context.responses);
+  EXPECT_EQ(4, context.destroyed_actions);
+}
+
+TEST(RpcFlowControlTest, ActionTimeoutFinishesOnStrand) {
+  ThreadPool thread_pool(2);
+  Strand strand(&thread_pool);
+  TimerWheel timers(1000);
+  int64_t now = MonotonicClock::MicroSeconds();
+  StallContext context;
+  context.set_strand(&strand);
+  bool flag = false;
+  RpcFlowControl* flow_control = RpcFlowControl::Create();
+  flow_control->set_action_timeout(&timers, 5000);
+  flow_control->Run(&context, false, NewCallback(&SetFlag, &flag));
+  ASSERT_EQ(2u, context.stalled.size());
+  context.stalled[0]->Run();
+  // 按时的action都处理完了，只等超时
+  thread_pool.WaitForIdle();
+
+  // 超时后Finish投递到strand上，不在驱动TimerWheel的线程上跑
+  timers.Advance(now + 1000 * 1000);
+  thread_pool.WaitForIdle();
+  EXPECT_TRUE(flag);
+  EXPECT_NE(std::this_thread::get_id(), context.finish_thread);
+  ASSERT_EQ(4u, context.missed_deadline.size());
+  EXPECT_TRUE(context.missed_deadline[3]);
+  EXPECT_EQ(3, context.responses);
+
+  context.stalled[1]->Run();
+  thread_pool.WaitForIdle();
+}
+
+TEST(RpcFlowControlTest, ActionTimeoutNotReached) {
+  TimerWheel timers(1000);
+  StallContext context;
+  bool flag = false;
+  RpcFlowControl* flow_control = RpcFlowControl::Create();
+  flow_control->set_action_timeout(&timers, 1000 * 1000);
+  flow_control->Run(&context, false, NewCallback(&SetFlag, &flag));
+  ASSERT_EQ(2u, context.stalled.size());
+  context.stalled[1]->Run();
+  context.stalled[0]->Run();
+  EXPECT_TRUE(flag);
+  EXPECT_EQ(4, context.responses);
+  EXPECT_EQ(std::vector<bool>(4, false), context.missed_deadline);
+  // 定时器已经取消
+  EXPECT_EQ(0u, timers.size());
+}
+
+// action边构造边执行；没有thread_pool时记下构造和调用的顺序
+class StreamContext : public RpcContext {
+ public:
+  StreamContext()
+    : record(true), calls(0), started_while_building(0), responses(0),
+      finished_actions(0) {}
+  std::string GetStartState() {
+    return "StreamState";
+  }
+
+  bool record;
+  std::vector<std::string> events;
+  std::atomic<int> calls;
+  // 有thread_pool时，构造下一个action前已经开始调用的action个数
+  int started_while_building;
+  std::atomic<int> responses;
+  int finished_actions;
+};
+
+class StreamAction : public RpcAction {
+ public:
+  StreamAction(int index, bool record) : index_(index), record_(record) {}
+  virtual int CallService(RpcContext* context, Closure* done) {
+    StreamContext* stream_context = static_cast<StreamContext*>(context);
+    if (record_) {
+      stream_context->events.push_back("call" + std::to_string(index_));
+    }
+    ++stream_context->calls;
+    done->Run();
+    return kActionSucceed;
+  }
+  virtual void ProcessResponse(RpcContext* context) {
+    ++static_cast<StreamContext*>(context)->responses;
+  }
+
+ private:
+  int index_;
+  bool record_;
+};
+
+static const int kStreamActionNum = 8;
+
+class StreamState : public RpcState {
+ public:
+  void MakeUpActions(RpcContext* context,
+                     std::vector<shared_ptr<RpcAction> >* actions) {
+    ADD_FAILURE() << "LaunchActions is used instead";
+  }
+  bool LaunchActions(RpcContext* context, RpcActionLauncher* launcher) {
+    StreamContext* stream_context = static_cast<StreamContext*>(context);
+    bool record = stream_context->record;
+    for (int i = 0; i < kStreamActionNum; ++i) {
+      if (record) {
+        stream_context->events.push_back("make" + std::to_string(i));
+      }
+      launcher->Launch(shared_ptr<RpcAction>(new StreamAction(i, record)));
+      if (!record) {
+        // 放到了thread_pool上，等它开始调用再构造下一个
+        for (int spin = 0; spin < 1000000 && stream_context->calls <= i;
+             ++spin) {
+          std::this_thread::yield();
+        }
+        if (stream_context->calls > i) {
+          ++stream_context->started_while_building;
+        }
+      }
+    }
+    return true;
+  }
+  std::string Finish(RpcContext* context,
+                     const std::vector<shared_ptr<RpcAction> >& actions) {
+    ADD_FAILURE() << "FinishWithId is used instead";
+    return kRpcStateEnd;
+  }
+  RpcStateId FinishWithId(RpcContext* context,
+                          const std::vector<shared_ptr<RpcAction> >& actions) {
+    static_cast<StreamContext*>(context)->finished_actions = actions.size();
+    return kRpcStateEndId;
+  }
+};
+REGISTER_RPC_STATE(StreamState);
+
+TEST(RpcFlowControlTest, LaunchActionsAsBuilt) {
+  StreamContext context;
+  bool flag = false;
+  RpcFlowControl::Create()->Run(&context, false,
+                                NewCallback(&SetFlag, &flag));
+  EXPECT_TRUE(flag);
+  EXPECT_EQ(kStreamActionNum, context.responses.load());
+  EXPECT_EQ(kStreamActionNum, context.finished_actions);
+  // 每个action构造完马上调用，不等后面的构造
+  ASSERT_EQ(2u * kStreamActionNum, context.events.size());
+  for (int i = 0; i < kStreamActionNum; ++i) {
+    EXPECT_EQ("make" + std::to_string(i), context.events[2 * i]);
+    EXPECT_EQ("call" + std::to_string(i), context.events[2 * i + 1]);
+  }
+}
+
+TEST(RpcFlowControlTest, LaunchActionsOnThreadPool) {
+  ThreadPool thread_pool(4);
+  StreamContext context;
+  context.record = false;
+  bool flag = false;
+  RpcFlowControl* flow_control = RpcFlowControl::Create();
+  flow_control->set_thread_pool(&thread_pool);
+  flow_control->Run(&context, false, NewCallback(&SetFlag, &flag));
+  thread_pool.WaitForIdle();
+  EXPECT_TRUE(flag);
+  EXPECT_EQ(kStreamActionNum, context.responses.load());
+  EXPECT_EQ(kStreamActionNum, context.finished_actions);
+  // 每个action一构造好就开始执行，不等下一个
+  EXPECT_EQ(kStreamActionNum, context.started_while_building);
+}
+
+// 每个state带kAllocActionNum个立即完成的action
+static const int kAllocActionNum = 3;
+
+class NopAction : public RpcAction {
+ public:
+  virtual int CallService(RpcContext* context, Closure* done) {
+    done->Run();
+    return kActionSucceed;
+  }
+  virtual void ProcessResponse(RpcContext* context) { }
+};
+
+class AllocFirstState : public RpcState {
+ public:
+  void MakeUpActions(RpcContext* context,
+                     std::vector<shared_ptr<RpcAction> >* actions) {
+    UncountedAllocationScope uncounted;
+    for (int i = 0; i < kAllocActionNum; ++i) {
+      actions->push_back(shared_ptr<RpcAction>(new NopAction));
+    }
+  }
+  std::string Finish(RpcContext* context,
+                     const std::vector<shared_ptr<RpcAction> >& actions) {
+    UncountedAllocationScope uncounted;
+    return "AllocLastState";
+  }
+};
+REGISTER_RPC_STATE(AllocFirstState);
+
+class AllocLastState : public AllocFirstState {
+ public:
+  std::string Finish(RpcContext* context,
+                     const std::vector<shared_ptr<RpcAction> >& actions) {
+    UncountedAllocationScope uncounted;
+    return kRpcStateEnd;
+  }
+};
+REGISTER_RPC_STATE(AllocLastState);
+
+class AllocContext : public RpcContext {
+ public:
+  std::string GetStartState() {
+    UncountedAllocationScope uncounted;
+    return "AllocFirstState";
+  }
+  RpcState* CreateState(RpcStateId state_id) {
+    UncountedAllocationScope uncounted;
+    return RpcContext::CreateState(state_id);
+  }
+  using RpcContext::CreateState;
+};
+
+TEST(RpcFlowControlTest, RunAllocatesNoClosures) {
+  AllocContext context;
+  // 先跑一遍，让CallbackPool的线程缓存就位
+  RpcFlowControl::Create()->Run(&context, false);
+
+  RpcFlowControl* flow_control = RpcFlowControl::Create();
+  g_allocation_count = 0;
+  g_count_allocations = true;
+  flow_control->Run(&context, false);
+  g_count_allocations = false;
+  // 每个state只剩下: current_state_的shared_ptr计数块，
+  // 以及每个action一个RpcActionRunner；回调本身不再分配，
+  // RpcStateRunner和它的barrier嵌在RpcFlowControl里各state共用
+  const int kStateNum = 2;
+  EXPECT_EQ(kStateNum * (1 + kAllocActionNum), g_allocation_count);
+}
+
+// 下个state没注册，但自己就是end_state，不会跳过去
+class UnregisteredNextState : public AllocFirstState {
+ public:
+  std::string Finish(RpcContext* context,
+                     const std::vector<shared_ptr<RpcAction> >& actions) {
+    return "NoSuchState";
+  }
+};
+REGISTER_RPC_STATE(UnregisteredNextState);
+
+TEST(RpcFlowControlTest, EndStateIgnoresUnregisteredNextState) {
+  AllocContext context;
+  bool flag = false;
+  RpcFlowControl* flow_control = RpcFlowControl::Create();
+  flow_control->Run(&context, false, "UnregisteredNextState",
+                    "UnregisteredNextState", NewCallback(&SetFlag, &flag));
+  EXPECT_TRUE(flag);
+}
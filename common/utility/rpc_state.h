@@ -5,11 +5,27 @@
 #include <vector>
 #include <string>
 #include "base/class_register.h"
+#include "base/shared_ptr.h"
 
 const char kRpcStateEnd[] = "rpc_state_end";
 
 class RpcAction;
 class RpcContext;
+class RpcState;
+
+// 注册的state的id，见GetRpcStateId
+typedef ClassRegistry<RpcState>::CreatorId RpcStateId;
+const RpcStateId kInvalidRpcStateId =
+    ClassRegistry<RpcState>::kInvalidCreatorId;
+// kRpcStateEnd对应的id
+const RpcStateId kRpcStateEndId = -2;
+
+// 接收构造好的action，见RpcState::LaunchActions
+class RpcActionLauncher {
+ public:
+  virtual ~RpcActionLauncher() { }
+  virtual void Launch(const shared_ptr<RpcAction>& action) = 0;
+};
 
 class RpcState {
  public:
@@ -20,11 +36,31 @@ class RpcState {
       RpcContext* context,
       std::vector<shared_ptr<RpcAction> >* actions) = 0;
 
+  // 可选：构造好一个action就调用launcher->Launch，action马上开始执行，
+  // 第一个下游调用不用等最后一个action构造完；action构造比较慢的state
+  // 可以重载。返回false表示不支持(默认)，这时调用MakeUpActions。
+  // 设置了thread_pool时每个action都投递到thread_pool上，
+  // 不像MakeUpActions那样最后一个留在当前线程执行。
+  // 设置了action超时时不调用，只用MakeUpActions
+  virtual bool LaunchActions(RpcContext* context,
+                             RpcActionLauncher* launcher) {
+    return false;
+  }
+
   // 所有actions结束后的处理; 返回值是下个state的名字
   // state_string="rpc_state_end"是一个特殊的state，表示流程结束
   virtual std::string Finish(
       RpcContext* context,
       const std::vector<shared_ptr<RpcAction> >& actions) = 0;
+
+  // 同Finish，但返回下个state的id，RpcFlowControl调用这个。
+  // 默认调用Finish再按名字查id；重载后不用每次跳转都构造名字再查表，
+  // 一般把id存在static里，第一次用到时查一次：
+  //   static const RpcStateId kTripleState = GetRpcStateId("TripleState");
+  //   return kTripleState;
+  virtual RpcStateId FinishWithId(
+      RpcContext* context,
+      const std::vector<shared_ptr<RpcAction> >& actions);
 };
 
 CLASS_REGISTER_DEFINE_REGISTRY(rpc_state_register, RpcState);
@@ -36,5 +72,28 @@ CLASS_REGISTER_DEFINE_REGISTRY(rpc_state_register, RpcState);
 #define CREATE_RPC_STATE(state_name_as_string) \
   CLASS_REGISTER_CREATE_OBJECT(rpc_state_register, state_name_as_string)
 
+// 名字对应的id，kRpcStateEnd对应kRpcStateEndId，没注册的是kInvalidRpcStateId
+inline RpcStateId GetRpcStateId(const std::string& state_name) {
+  if (state_name == kRpcStateEnd) {
+    return kRpcStateEndId;
+  }
+  return CLASS_REGISTER_GET_CREATOR_ID(rpc_state_register, state_name);
+}
+
+// kRpcStateEndId对应kRpcStateEnd，没注册的id返回空串
+inline const std::string& GetRpcStateName(RpcStateId state_id) {
+  static const std::string end_name(kRpcStateEnd);
+  if (state_id == kRpcStateEndId) {
+    return end_name;
+  }
+  return GetRegistry<rpc_state_registerRegistryTag>().GetCreatorName(state_id);
+}
+
+inline RpcStateId RpcState::FinishWithId(
+    RpcContext* context,
+    const std::vector<shared_ptr<RpcAction> >& actions) {
+  return GetRpcStateId(Finish(context, actions));
+}
+
 #endif  // RPC_STATE_H_
 